@@ -0,0 +1,241 @@
+#pragma once
+
+#include "CompactGeneralType.hpp"
+
+#include<array>
+#include<cstddef>
+#include<cstdint>
+#include<cstring>
+#include<new>
+#include<type_traits>
+#include<utility>
+#include<variant>
+
+// An atomic storage of the values held by GeneralTypes whose types are all small and trivially copyable, e.g.
+// counters and flags of type `bool`, `int` or `double` that are updated by several threads without a lock.
+// Every type has to fit into 8 bytes, as for the inline storage of a `CompactGeneralType`. A value is stored
+// as a double word of the bytes of the value and the index of its type, 16 bytes that are read and replaced
+// as one by `cmpxchg16b` on x86-64. Types that do not fit are rejected at compile time. Unlike the 8 byte
+// `NanBoxedGeneralType`, the double word holds every value of every type, e.g. the full range of the internal
+// `long int` that default constructed values and sums like `long int + int` have.
+// Read-modify-write operations like `fetch_add` apply the operator of the GeneralType in a compare-and-swap
+// loop, so the type of the stored value changes like it would by `+=`.
+
+namespace {
+
+//! Checks if the types of `GenType` fit into the 16 byte word of an `AtomicGeneralType`
+template<typename GenType>
+constexpr bool isDoubleWordStorable = false;
+
+template<typename ErrorPolicy, typename ... Types_>
+constexpr bool isDoubleWordStorable<BasicGeneralType<ErrorPolicy,Types_...>> = (isStoredInline<Types_> && ...);
+
+//! Two 8 byte words that are compared and swapped as one
+struct alignas(16) DoubleWord {
+    std::uint64_t low;
+    std::uint64_t high;
+};
+
+//! Checks if a `DoubleWord` is compared and swapped without a lock
+#if defined(__x86_64__)
+constexpr bool isDoubleWordLockFree = true;
+#else
+constexpr bool isDoubleWordLockFree = __atomic_always_lock_free(sizeof(DoubleWord), 0);
+#endif
+
+//! Replace `target` by `desired` if it equals `expected`, otherwise load it into `expected`.
+//! Returns whether `target` was replaced, the exchange is sequentially consistent.
+inline bool compareExchange(DoubleWord & target, DoubleWord & expected, DoubleWord desired) noexcept {
+#if defined(__x86_64__)
+    // every x86-64 CPU since 2006 has cmpxchg16b, inline assembly does not require compiling with -mcx16
+    bool exchanged;
+    asm volatile("lock cmpxchg16b %1"
+        : "=@ccz"(exchanged), "+m"(target), "+a"(expected.low), "+d"(expected.high)
+        : "b"(desired.low), "c"(desired.high)
+        : "memory");
+    return exchanged;
+#else
+    // other architectures use the double word instruction they have or the lock of libatomic
+    return __atomic_compare_exchange(&target, &expected, &desired, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+#endif
+}
+
+} // namespace
+
+//! An atomic storage of the values held by GeneralTypes of type `GenType`
+template<typename GenType>
+class BasicAtomicGeneralType;
+
+template<typename ErrorPolicy, typename ... Types_>
+class BasicAtomicGeneralType<BasicGeneralType<ErrorPolicy,Types_...>> {
+    protected:
+    using GenType = BasicGeneralType<ErrorPolicy,Types_...>;
+    using Variant = typename GenType::Variant;
+
+    static_assert(isDoubleWordStorable<GenType>,
+        "An AtomicGeneralType requires types that are trivially copyable and have at most 8 bytes, "
+        "such that a value and the index of its type fit into a 16 byte compare-and-swap");
+
+    static constexpr std::size_t numberOfAlternatives = GenType::numberOfAlternatives;
+
+    template<std::size_t Index>
+    using Alternative = std::variant_alternative_t<Index,Variant>;
+
+    public:
+    //! If all operations are lock-free on every CPU of the target architecture
+    static constexpr bool is_always_lock_free = isDoubleWordLockFree;
+
+    //! Holds the same value as a default constructed GeneralType
+    BasicAtomicGeneralType() :
+        word_(encode(GenType()))
+    {}
+
+    //! Store the value held by `genT`
+    BasicAtomicGeneralType(const GenType & genT) :
+        word_(encode(genT))
+    {}
+
+    BasicAtomicGeneralType(const BasicAtomicGeneralType &) = delete;
+    BasicAtomicGeneralType & operator=(const BasicAtomicGeneralType &) = delete;
+
+    //! Store the value held by `genT`, returns it like the assignment of a `std::atomic`
+    GenType operator=(const GenType & genT){
+        store(genT);
+        return genT;
+    }
+
+    //! A GeneralType holding the stored value
+    operator GenType() const {
+        return load();
+    }
+
+    //! If the operations are lock-free
+    bool is_lock_free() const noexcept {
+        return is_always_lock_free;
+    }
+
+    //! A GeneralType holding the stored value
+    GenType load() const {
+        return decode(loadWord());
+    }
+
+    //! Replace the stored value by the value held by `genT`
+    void store(const GenType & genT){
+        exchangeWord(encode(genT));
+    }
+
+    //! Replace the stored value by the value held by `genT`, returns the replaced value
+    GenType exchange(const GenType & genT){
+        return decode(exchangeWord(encode(genT)));
+    }
+
+    /*!
+     * Replace the stored value by `desired` if it equals `expected` in type and bytes, which also distinguishes
+     * `0.0` from `-0.0`, and return true. Otherwise `expected` is assigned the stored value and false is returned.
+     */
+    bool compare_exchange_strong(GenType & expected, const GenType & desired){
+        DoubleWord word = encode(expected);
+        if( compareExchangeWord(word, encode(desired)) ){
+            return true;
+        }
+        expected = decode(word);
+        return false;
+    }
+
+    //! Same as `compare_exchange_strong`, but may fail although the stored value equals `expected`
+    bool compare_exchange_weak(GenType & expected, const GenType & desired){
+        return compare_exchange_strong(expected, desired);
+    }
+
+    //! Replace the stored value by its sum with `genT`, returns the replaced value. The sum has the type
+    //! `operator+` of the GeneralType returns, nothing is stored if it throws.
+    GenType fetch_add(const GenType & genT){
+        return fetchOperation([&genT](const GenType & current){ return current + genT; });
+    }
+
+    //! Replace the stored value by its difference with `genT`, returns the replaced value
+    GenType fetch_sub(const GenType & genT){
+        return fetchOperation([&genT](const GenType & current){ return current - genT; });
+    }
+
+    protected:
+    //! Replace the stored value by `operation(value)` in a compare-and-swap loop, returns the replaced value
+    template<typename Operation>
+    GenType fetchOperation(Operation && operation){
+        DoubleWord word = loadWord();
+        while( true ){
+            GenType current = decode(word);
+            if( compareExchangeWord(word, encode(operation(std::as_const(current)))) ){
+                return current;
+            }
+        }
+    }
+
+    DoubleWord loadWord() const noexcept {
+        // cmpxchg16b is the only atomic 16 byte load, it replaces an all-zero word by itself
+        DoubleWord word{0, 0};
+        compareExchange(word_, word, word);
+        return word;
+    }
+
+    DoubleWord exchangeWord(DoubleWord desired) noexcept {
+        DoubleWord word = loadWord();
+        while( !compareExchange(word_, word, desired) ){}
+        return word;
+    }
+
+    //! Replace the stored word by `desired` if it equals `expected`, otherwise load it into `expected`
+    bool compareExchangeWord(DoubleWord & expected, DoubleWord desired) noexcept {
+        return compareExchange(word_, expected, desired);
+    }
+
+    static DoubleWord encode(const GenType & genT){
+        static constexpr auto table = makeEncodeTable(std::make_index_sequence<numberOfAlternatives>{});
+        if( genT.obj_.valueless_by_exception() ) [[unlikely]] {
+            throw std::bad_variant_access();
+        }
+        return table[genT.obj_.index()](genT);
+    }
+
+    static GenType decode(DoubleWord word){
+        static constexpr auto table = makeDecodeTable(std::make_index_sequence<numberOfAlternatives>{});
+        return table[word.high](word);
+    }
+
+    //! Table entry of `encode` for the alternative `Index`: the bytes of the value, zero-padded, and the index
+    template<std::size_t Index>
+    static DoubleWord encodeEntry(const GenType & genT){
+        DoubleWord word{0, Index};
+        std::memcpy(&word.low, std::get_if<Index>(&genT.obj_), sizeof(Alternative<Index>));
+        return word;
+    }
+
+    template<std::size_t ... Indices>
+    static constexpr auto makeEncodeTable(std::index_sequence<Indices...>){
+        using Entry = DoubleWord (*)(const GenType &);
+        return std::array<Entry, sizeof...(Indices)>{ &encodeEntry<Indices>... };
+    }
+
+    //! Table entry of `decode` for the alternative `Index`
+    template<std::size_t Index>
+    static GenType decodeEntry(DoubleWord word){
+        alignas(Alternative<Index>) unsigned char bytes[sizeof(Alternative<Index>)];
+        std::memcpy(bytes, &word.low, sizeof(Alternative<Index>));
+        GenType genT;
+        genT.obj_.template emplace<Index>(*std::launder(reinterpret_cast<const Alternative<Index> *>(bytes)));
+        return genT;
+    }
+
+    template<std::size_t ... Indices>
+    static constexpr auto makeDecodeTable(std::index_sequence<Indices...>){
+        using Entry = GenType (*)(DoubleWord);
+        return std::array<Entry, sizeof...(Indices)>{ &decodeEntry<Indices>... };
+    }
+
+    //! The stored value, written by `loadWord` as well
+    mutable DoubleWord word_;
+}; // BasicAtomicGeneralType<GenType>
+
+//! An atomic storage of the values held by a `GeneralType<Types_...>` of small trivially copyable types
+template<typename ... Types_>
+using AtomicGeneralType = BasicAtomicGeneralType<GeneralType<Types_...>>;
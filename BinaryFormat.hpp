@@ -0,0 +1,558 @@
+#pragma once
+
+#include "GeneralDict.hpp"
+
+#include<bit>
+#include<complex>
+#include<cstddef>
+#include<cstdint>
+#include<cstring>
+#include<istream>
+#include<iterator>
+#include<limits>
+#include<map>
+#include<ostream>
+#include<span>
+#include<stdexcept>
+#include<string>
+#include<string_view>
+#include<vector>
+
+// A versioned binary format for GeneralTypes and dictionaries of GeneralTypes.
+// All numbers are stored little endian. A document starts with a header:
+//  - the magic bytes "GTYP"
+//  - the format version (uint32)
+//  - the kind of the document (uint8): a single GeneralType or a dictionary
+//  - a hash of the portable names of the alternatives (uint64), e.g. "i32" or "vector<f64>",
+//    such that data is only read by a GeneralType with the same type list
+// followed by the content:
+//  - a GeneralType is the index of the held alternative (uint8) and its payload
+//  - a dictionary is the number of entries (uint64) and the key and the GeneralType of each entry
+// Payloads of arithmetic types are their raw bytes, `std::complex` the real and imaginary part, strings
+// their size (uint64) and characters and vectors their size and elements. Vectors of arithmetic types
+// and `std::complex` are copied as one block, `std::vector<bool>` is packed to 8 elements per byte.
+
+namespace {
+
+//! Checks if `Type` can be stored in the binary format
+template<typename Type>
+constexpr bool isBinaryEncodable = std::is_integral_v<Type>
+    || ((std::is_same_v<Type,float> || std::is_same_v<Type,double>) && std::numeric_limits<Type>::is_iec559);
+
+template<typename Type>
+constexpr bool isBinaryEncodable<std::complex<Type>> = isBinaryEncodable<Type> && std::is_floating_point_v<Type>;
+
+template<>
+constexpr bool isBinaryEncodable<std::string> = true;
+
+template<typename Element>
+constexpr bool isBinaryEncodable<std::vector<Element>> = isBinaryEncodable<Element>;
+
+//! Checks if a contiguous range of `Type` is stored as a single block of bytes
+template<typename Type>
+constexpr bool isBlockEncodable = isBinaryEncodable<Type> && !std::is_same_v<Type,bool>
+    && (std::is_arithmetic_v<Type> || isComplex<Type>);
+
+//! The portable name of `Type` in the binary format, independent of the compiler and platform
+template<typename Type>
+std::string binaryTypeName(){
+    if constexpr( std::is_same_v<Type,bool> ){
+        return "bool";
+    } else if constexpr( std::is_integral_v<Type> ){
+        return (std::is_signed_v<Type> ? "i" : "u") + std::to_string(8 * sizeof(Type));
+    } else if constexpr( std::is_floating_point_v<Type> ){
+        return "f" + std::to_string(8 * sizeof(Type));
+    } else if constexpr( isComplex<Type> ){
+        return "complex<" + binaryTypeName<typename Type::value_type>() + ">";
+    } else if constexpr( std::is_same_v<Type,std::string> ){
+        return "string";
+    } else {
+        return "vector<" + binaryTypeName<typename Type::value_type>() + ">";
+    }
+}
+
+//! Appends the binary representation of values to a buffer
+class BinaryEncoder {
+    public:
+    explicit BinaryEncoder(std::vector<std::byte> & out) :
+        out_(out), size_(out.size())
+    {}
+
+    //! Shrink the buffer to the written bytes
+    ~BinaryEncoder(){
+        out_.resize(size_);
+    }
+
+    //! Append `size` raw bytes
+    void writeBytes(const void * data, std::size_t size){
+        if( size == 0 ){ return; }
+        // grow the buffer geometrically and keep track of the written bytes, which avoids
+        // resizing the buffer for every value
+        if( size_ + size > out_.size() ){
+            out_.resize(std::max(2 * out_.size(), size_ + size));
+        }
+        std::memcpy(out_.data() + size_, data, size);
+        size_ += size;
+    }
+
+    //! Append an arithmetic value in little endian byte order
+    template<typename Type>
+    void writeScalar(Type value){
+        std::byte bytes[sizeof(Type)];
+        std::memcpy(bytes, &value, sizeof(Type));
+        if constexpr( std::endian::native == std::endian::big ){
+            std::reverse(std::begin(bytes), std::end(bytes));
+        }
+        writeBytes(bytes, sizeof(Type));
+    }
+
+    //! Append a size or count
+    void writeSize(std::size_t size){
+        writeScalar(std::uint64_t(size));
+    }
+
+    //! Append the payload of `value`
+    template<typename Type>
+        requires( isBinaryEncodable<Type> )
+    void write(const Type & value){
+        if constexpr( std::is_arithmetic_v<Type> ){
+            writeScalar(value);
+        } else if constexpr( isComplex<Type> ){
+            writeScalar(value.real());
+            writeScalar(value.imag());
+        } else if constexpr( std::is_same_v<Type,std::string> ){
+            writeSize(value.size());
+            writeBytes(value.data(), value.size());
+        } else if constexpr( std::is_same_v<Type,std::vector<bool>> ){
+            writeSize(value.size());
+            for(std::size_t begin = 0; begin < value.size(); begin += 8){
+                std::uint8_t packed = 0;
+                for(std::size_t i = begin; i < std::min(begin + 8, value.size()); ++i){
+                    packed |= std::uint8_t(value[i]) << (i - begin);
+                }
+                writeScalar(packed);
+            }
+        } else {
+            using Element = typename Type::value_type;
+            writeSize(value.size());
+            if constexpr( isBlockEncodable<Element> && std::endian::native == std::endian::little ){
+                writeBytes(value.data(), value.size() * sizeof(Element));
+            } else {
+                for(const Element & element: value){ write(element); }
+            }
+        }
+    }
+
+    //! Number of bytes in the buffer, including the bytes written before this encoder was created
+    std::size_t size() const {
+        return size_;
+    }
+
+    protected:
+    std::vector<std::byte> & out_;
+
+    //! Number of bytes written to `out_`, the rest of `out_` is unused
+    std::size_t size_;
+};
+
+//! Reads values from their binary representation
+class BinaryDecoder {
+    public:
+    explicit BinaryDecoder(std::span<const std::byte> in) :
+        in_(in)
+    {}
+
+    //! Read `size` raw bytes into `data`
+    void readBytes(void * data, std::size_t size){
+        require(size);
+        if( size == 0 ){ return; }
+        std::memcpy(data, in_.data() + position_, size);
+        position_ += size;
+    }
+
+    //! View `size` raw bytes as characters without copying them
+    std::string_view readView(std::size_t size){
+        require(size);
+        const std::string_view view(reinterpret_cast<const char *>(in_.data()) + position_, size);
+        position_ += size;
+        return view;
+    }
+
+    //! Read an arithmetic value stored in little endian byte order
+    template<typename Type>
+    Type readScalar(){
+        std::byte bytes[sizeof(Type)];
+        readBytes(bytes, sizeof(Type));
+        if constexpr( std::endian::native == std::endian::big ){
+            std::reverse(std::begin(bytes), std::end(bytes));
+        }
+        Type value;
+        std::memcpy(&value, bytes, sizeof(Type));
+        return value;
+    }
+
+    //! Read the size of a range of elements taking at least `minimalElementSize` bytes each
+    std::size_t readSize(std::size_t minimalElementSize = 0){
+        const std::uint64_t size = readScalar<std::uint64_t>();
+        // reject sizes exceeding the remaining data before allocating for them
+        if( minimalElementSize > 0 && size > remaining() / minimalElementSize ){
+            throw std::runtime_error("Invalid size " + std::to_string(size) + " in binary GeneralType data");
+        }
+        return std::size_t(size);
+    }
+
+    //! Read the payload of a value of type `Type`
+    template<typename Type>
+        requires( isBinaryEncodable<Type> )
+    Type read(){
+        if constexpr( std::is_arithmetic_v<Type> ){
+            return readScalar<Type>();
+        } else if constexpr( isComplex<Type> ){
+            using Part = typename Type::value_type;
+            const Part real = readScalar<Part>();
+            return Type(real, readScalar<Part>());
+        } else if constexpr( std::is_same_v<Type,std::string> ){
+            std::string value(readSize(1), '\0');
+            readBytes(value.data(), value.size());
+            return value;
+        } else if constexpr( std::is_same_v<Type,std::vector<bool>> ){
+            const std::size_t size = readSize();
+            require(size / 8 + (size % 8 != 0));
+            std::vector<bool> value(size);
+            for(std::size_t begin = 0; begin < size; begin += 8){
+                const std::uint8_t packed = readScalar<std::uint8_t>();
+                for(std::size_t i = begin; i < std::min(begin + 8, size); ++i){
+                    value[i] = (packed >> (i - begin)) & 1;
+                }
+            }
+            return value;
+        } else {
+            using Element = typename Type::value_type;
+            if constexpr( isBlockEncodable<Element> ){
+                Type value(readSize(sizeof(Element)));
+                if constexpr( std::endian::native == std::endian::little ){
+                    readBytes(value.data(), value.size() * sizeof(Element));
+                } else {
+                    for(Element & element: value){ element = read<Element>(); }
+                }
+                return value;
+            } else {
+                // every element takes at least one byte
+                const std::size_t size = readSize(1);
+                Type value;
+                value.reserve(size);
+                for(std::size_t i = 0; i < size; ++i){
+                    value.push_back(read<Element>());
+                }
+                return value;
+            }
+        }
+    }
+
+    //! Number of bytes not read yet
+    std::size_t remaining() const {
+        return in_.size() - position_;
+    }
+
+    protected:
+    //! Throw if less than `size` bytes remain
+    void require(std::size_t size) const {
+        if( size > remaining() ){
+            throw std::runtime_error("Unexpected end of binary GeneralType data");
+        }
+    }
+
+    std::span<const std::byte> in_;
+    std::size_t position_ = 0;
+};
+
+//! The magic bytes at the start of every document
+constexpr char binaryMagic[4] = {'G','T','Y','P'};
+
+//! Kinds of documents
+enum class BinaryDocument : std::uint8_t {
+    value = 0,
+    dictionary = 1
+};
+
+} // namespace
+
+//! Version of the binary format, readers reject documents of other versions
+constexpr std::uint32_t binaryFormatVersion = 1;
+
+/*!
+ * Reads and writes the GeneralTypes of type `GenType` in the binary format. The held alternative is
+ * dispatched through a table with one entry per alternative.
+ */
+template<typename ErrorPolicy, typename ... Types_>
+struct BinaryFormat<BasicGeneralType<ErrorPolicy,Types_...>> {
+    using GenType = BasicGeneralType<ErrorPolicy,Types_...>;
+    using Variant = typename GenType::Variant;
+
+    static constexpr std::size_t numberOfAlternatives = GenType::numberOfAlternatives;
+    static_assert(numberOfAlternatives <= 256, "The binary format stores the index of the alternative in a single byte");
+
+    //! Hash of the portable names of the alternatives, alternatives that can not be stored contribute "-"
+    static std::uint64_t typeListHash(){
+        static const std::uint64_t hash = []{
+            std::string names;
+            addNames(names, std::make_index_sequence<numberOfAlternatives>{});
+            return hashKey(names);
+        }();
+        return hash;
+    }
+
+    //! Append the index of the alternative held by `genT` and its payload
+    static void encode(BinaryEncoder & encoder, const GenType & genT){
+        static constexpr auto table = makeEncodeTable(std::make_index_sequence<numberOfAlternatives>{});
+        if( genT.obj_.valueless_by_exception() ) [[unlikely]] {
+            throw std::bad_variant_access();
+        }
+        table[genT.obj_.index()](encoder, genT);
+    }
+
+    //! Read a GeneralType written by `encode`
+    static GenType decode(BinaryDecoder & decoder){
+        static constexpr auto table = makeDecodeTable(std::make_index_sequence<numberOfAlternatives>{});
+        const std::size_t index = decoder.template readScalar<std::uint8_t>();
+        if( index >= numberOfAlternatives ){
+            throw std::runtime_error("Invalid alternative " + std::to_string(index) + " in binary GeneralType data");
+        }
+        return table[index](decoder);
+    }
+
+    //! Read the entries of a dictionary into the empty `dict`. The entries are appended in the order
+    //! they were written and the hash table is built once at the end.
+    template<bool StableOrder>
+    static void decodeEntries(BinaryDecoder & decoder, BasicGeneralDict<ErrorPolicy,StableOrder,Types_...> & dict){
+        using Entry = typename BasicGeneralDict<ErrorPolicy,StableOrder,Types_...>::Entry;
+        // every entry takes at least the size of its key and the index of its alternative
+        const std::size_t size = decoder.readSize(sizeof(std::uint64_t) + 1);
+        dict.entries_.reserve(size);
+        for(std::size_t i = 0; i < size; ++i){
+            const std::string_view key = decoder.readView(decoder.readSize(1));
+            dict.entries_.push_back(Entry{std::string(key), decode(decoder), hashKey(key)});
+        }
+        if( !dict.rebuildUnique() ){
+            throw std::runtime_error("Duplicate key in binary GeneralType data");
+        }
+    }
+
+    protected:
+    template<std::size_t ... Indices>
+    static void addNames(std::string & names, std::index_sequence<Indices...>){
+        ((names += alternativeName<std::variant_alternative_t<Indices,Variant>>() + ";"), ...);
+    }
+
+    template<typename Alternative>
+    static std::string alternativeName(){
+        if constexpr( isBinaryEncodable<Alternative> ){
+            return binaryTypeName<Alternative>();
+        } else {
+            return "-";
+        }
+    }
+
+    //! Table entry of `encode` for the alternative `Index`
+    template<std::size_t Index>
+    static void encodeEntry(BinaryEncoder & encoder, const GenType & genT){
+        using Alternative = std::variant_alternative_t<Index,Variant>;
+        if constexpr( isBinaryEncodable<Alternative> ){
+            encoder.writeScalar(std::uint8_t(Index));
+            encoder.write(*std::get_if<Index>(&genT.obj_));
+        } else {
+            ErrorPolicy::unsupported([]{
+                return "Can not store held type (" + GenType::alternativeName(Index) + ") in the binary format";
+            });
+        }
+    }
+
+    template<std::size_t ... Indices>
+    static constexpr auto makeEncodeTable(std::index_sequence<Indices...>){
+        using Entry = void (*)(BinaryEncoder &, const GenType &);
+        return std::array<Entry, sizeof...(Indices)>{ &encodeEntry<Indices>... };
+    }
+
+    //! Table entry of `decode` for the alternative `Index`
+    template<std::size_t Index>
+    static GenType decodeEntry(BinaryDecoder & decoder){
+        using Alternative = std::variant_alternative_t<Index,Variant>;
+        if constexpr( isBinaryEncodable<Alternative> ){
+            GenType genT;
+            genT.obj_.template emplace<Index>(decoder.template read<Alternative>());
+            return genT;
+        } else {
+            throw std::runtime_error(
+                "Invalid alternative (" + GenType::alternativeName(Index) + ") in binary GeneralType data"
+            );
+        }
+    }
+
+    template<std::size_t ... Indices>
+    static constexpr auto makeDecodeTable(std::index_sequence<Indices...>){
+        using Entry = GenType (*)(BinaryDecoder &);
+        return std::array<Entry, sizeof...(Indices)>{ &decodeEntry<Indices>... };
+    }
+};
+
+namespace {
+
+//! Append the header of a document of kind `kind` holding GeneralTypes of type `GenType`
+template<typename GenType>
+void encodeHeader(BinaryEncoder & encoder, BinaryDocument kind){
+    encoder.writeBytes(binaryMagic, sizeof(binaryMagic));
+    encoder.writeScalar(binaryFormatVersion);
+    encoder.writeScalar(std::uint8_t(kind));
+    encoder.writeScalar(BinaryFormat<GenType>::typeListHash());
+}
+
+//! Read and check the header of a document of kind `kind` holding GeneralTypes of type `GenType`
+template<typename GenType>
+void decodeHeader(BinaryDecoder & decoder, BinaryDocument kind){
+    char magic[sizeof(binaryMagic)];
+    decoder.readBytes(magic, sizeof(magic));
+    if( std::memcmp(magic, binaryMagic, sizeof(magic)) != 0 ){
+        throw std::runtime_error("Not a binary GeneralType document");
+    }
+    const std::uint32_t version = decoder.readScalar<std::uint32_t>();
+    if( version != binaryFormatVersion ){
+        throw std::runtime_error(
+            "Unsupported version " + std::to_string(version) + " of the binary GeneralType format, expected "
+            + std::to_string(binaryFormatVersion)
+        );
+    }
+    if( decoder.readScalar<std::uint8_t>() != std::uint8_t(kind) ){
+        throw std::runtime_error(
+            kind == BinaryDocument::value ? "The binary document does not hold a single GeneralType"
+                                          : "The binary document does not hold a dictionary"
+        );
+    }
+    if( decoder.readScalar<std::uint64_t>() != BinaryFormat<GenType>::typeListHash() ){
+        throw std::runtime_error("The binary document was written by a GeneralType with different types");
+    }
+}
+
+//! Append the entries of a dictionary, `Dict` is a `GeneralDict` or a `std::map` of strings and GeneralTypes
+template<typename GenType, typename Dict>
+void encodeEntries(BinaryEncoder & encoder, const Dict & dict){
+    encoder.writeSize(dict.size());
+    for(const auto & [key,value]: dict){
+        encoder.writeSize(key.size());
+        encoder.writeBytes(key.data(), key.size());
+        BinaryFormat<GenType>::encode(encoder, value);
+    }
+}
+
+//! Encode a single GeneralType
+template<typename ErrorPolicy, typename ... Types_>
+void encodeDocument(BinaryEncoder & encoder, const BasicGeneralType<ErrorPolicy,Types_...> & genT){
+    using GenType = BasicGeneralType<ErrorPolicy,Types_...>;
+    encodeHeader<GenType>(encoder, BinaryDocument::value);
+    BinaryFormat<GenType>::encode(encoder, genT);
+}
+
+//! Encode a `GeneralDict`
+template<typename ErrorPolicy, bool StableOrder, typename ... Types_>
+void encodeDocument(BinaryEncoder & encoder, const BasicGeneralDict<ErrorPolicy,StableOrder,Types_...> & dict){
+    using GenType = BasicGeneralType<ErrorPolicy,Types_...>;
+    encodeHeader<GenType>(encoder, BinaryDocument::dictionary);
+    encodeEntries<GenType>(encoder, dict);
+}
+
+//! Encode a `std::map` of strings and GeneralTypes
+template<typename ErrorPolicy, typename ... Types_, typename Compare, typename Allocator>
+void encodeDocument(
+    BinaryEncoder & encoder,
+    const std::map<std::string,BasicGeneralType<ErrorPolicy,Types_...>,Compare,Allocator> & dict)
+{
+    using GenType = BasicGeneralType<ErrorPolicy,Types_...>;
+    encodeHeader<GenType>(encoder, BinaryDocument::dictionary);
+    encodeEntries<GenType>(encoder, dict);
+}
+
+//! Decodes documents into values of type `Value`
+template<typename Value>
+struct DocumentDecoder;
+
+template<typename ErrorPolicy, typename ... Types_>
+struct DocumentDecoder<BasicGeneralType<ErrorPolicy,Types_...>> {
+    using GenType = BasicGeneralType<ErrorPolicy,Types_...>;
+
+    static GenType decode(BinaryDecoder & decoder){
+        decodeHeader<GenType>(decoder, BinaryDocument::value);
+        return BinaryFormat<GenType>::decode(decoder);
+    }
+};
+
+template<typename ErrorPolicy, bool StableOrder, typename ... Types_>
+struct DocumentDecoder<BasicGeneralDict<ErrorPolicy,StableOrder,Types_...>> {
+    using GenType = BasicGeneralType<ErrorPolicy,Types_...>;
+    using Dict = BasicGeneralDict<ErrorPolicy,StableOrder,Types_...>;
+
+    static Dict decode(BinaryDecoder & decoder){
+        decodeHeader<GenType>(decoder, BinaryDocument::dictionary);
+        Dict dict;
+        BinaryFormat<GenType>::decodeEntries(decoder, dict);
+        return dict;
+    }
+};
+
+template<typename ErrorPolicy, typename ... Types_, typename Compare, typename Allocator>
+struct DocumentDecoder<std::map<std::string,BasicGeneralType<ErrorPolicy,Types_...>,Compare,Allocator>> {
+    using GenType = BasicGeneralType<ErrorPolicy,Types_...>;
+    using Dict = std::map<std::string,GenType,Compare,Allocator>;
+
+    static Dict decode(BinaryDecoder & decoder){
+        decodeHeader<GenType>(decoder, BinaryDocument::dictionary);
+        Dict dict;
+        // every entry takes at least the size of its key and the index of its alternative
+        const std::size_t size = decoder.readSize(sizeof(std::uint64_t) + 1);
+        for(std::size_t i = 0; i < size; ++i){
+            std::string key(decoder.readView(decoder.readSize(1)));
+            if( !dict.try_emplace(std::move(key), BinaryFormat<GenType>::decode(decoder)).second ){
+                throw std::runtime_error("Duplicate key in binary GeneralType data");
+            }
+        }
+        return dict;
+    }
+};
+
+} // namespace
+
+//! Append the binary representation of `value`, a GeneralType, a `GeneralDict` or a
+//! `std::map<std::string,GenType>`, to `out`
+template<typename Value>
+void toBinary(const Value & value, std::vector<std::byte> & out){
+    BinaryEncoder encoder(out);
+    encodeDocument(encoder, value);
+}
+
+//! The binary representation of `value`, a GeneralType, a `GeneralDict` or a `std::map<std::string,GenType>`
+template<typename Value>
+std::vector<std::byte> toBinary(const Value & value){
+    std::vector<std::byte> out;
+    toBinary(value, out);
+    return out;
+}
+
+//! Read a `Value` from its binary representation, throws a `std::runtime_error` if `data` is not a valid document.
+//! Dictionaries written from a `GeneralDict` can be read into a `std::map` and vice versa.
+template<typename Value>
+Value fromBinary(std::span<const std::byte> data){
+    BinaryDecoder decoder(data);
+    return DocumentDecoder<Value>::decode(decoder);
+}
+
+//! Write the binary representation of `value` to the stream `os`, which should be opened in binary mode
+template<typename Value>
+void writeBinary(std::ostream & os, const Value & value){
+    const std::vector<std::byte> data = toBinary(value);
+    os.write(reinterpret_cast<const char *>(data.data()), std::streamsize(data.size()));
+}
+
+//! Read a `Value` from the rest of the stream `is`, which should be opened in binary mode
+template<typename Value>
+Value readBinary(std::istream & is){
+    std::vector<char> data{std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>()};
+    return fromBinary<Value>(std::as_bytes(std::span<const char>(data)));
+}
@@ -0,0 +1,414 @@
+#pragma once
+
+#include "GeneralTypeRef.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <ostream>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+// A compact storage of the objects GeneralTypes hold, for arrays and maps of many values. A GeneralType
+// is as large as its largest alternative, e.g. a `std::string` or `std::vector`, even if it holds an int.
+// A `CompactGeneralType` takes 16 bytes: alternatives that are trivially copyable and fit into 8 bytes,
+// e.g. `bool`, `int` and `double`, are stored inline, all others in a box on the heap. Freed boxes are
+// kept in a pool per thread and reused for the next boxed value of the same type.
+// A `CompactGeneralType` converts from and to its GeneralType, `borrow(compact)` references the stored
+// object by a `GeneralTypeRef` to apply the operators of the GeneralType without copying it.
+
+namespace {
+
+//! Checks if objects of `Type` are stored inline in a `CompactGeneralType`
+template<typename Type>
+constexpr bool isStoredInline = std::is_trivially_copyable_v<Type> && sizeof(Type) <= 8 && alignof(Type) <= 8;
+
+/*!
+ * Allocates the boxes of objects of `Type` that are not stored inline. Every thread keeps up to
+ * `capacity` freed boxes and reuses them before allocating new ones.
+ */
+template<typename Type>
+class BoxPool {
+    public:
+    static constexpr std::size_t capacity = 1024;
+
+    //! Construct an object of `Type` from `arguments` in a box
+    template<typename ... Arguments>
+    static Type * create(Arguments && ... arguments){
+        void * box = allocate();
+        try{
+            return ::new(box) Type(std::forward<Arguments>(arguments)...);
+        } catch(...){
+            deallocate(box);
+            throw;
+        }
+    }
+
+    //! Destroy the object in `box` and return the box to the pool
+    static void destroy(Type * box) noexcept {
+        box->~Type();
+        deallocate(box);
+    }
+
+    protected:
+    //! Boxes freed by the current thread, released when the thread ends
+    struct FreeBoxes {
+        std::vector<void *> boxes;
+
+        ~FreeBoxes(){
+            destroyed() = true;
+            for(void * box: boxes){
+                releaseBox(box);
+            }
+        }
+    };
+
+    //! Set once the free boxes of the current thread are destroyed. Boxed values destroyed later, e.g. by
+    //! the destructor of a static object, are freed directly. The flag is trivially destructible and thus
+    //! stays valid until the thread ends.
+    static bool & destroyed(){
+        thread_local bool destroyed = false;
+        return destroyed;
+    }
+
+    //! The free boxes of the current thread, nullptr if they are already destroyed
+    static FreeBoxes * freeBoxes(){
+        if( destroyed() ){
+            return nullptr;
+        }
+        thread_local FreeBoxes freeBoxes;
+        return &freeBoxes;
+    }
+
+    static void * allocate(){
+        FreeBoxes * freeBoxes = BoxPool::freeBoxes();
+        if( freeBoxes == nullptr || freeBoxes->boxes.empty() ){
+            return newBox();
+        }
+        void * box = freeBoxes->boxes.back();
+        freeBoxes->boxes.pop_back();
+        return box;
+    }
+
+    static void deallocate(void * box) noexcept {
+        FreeBoxes * freeBoxes = BoxPool::freeBoxes();
+        if( freeBoxes != nullptr && freeBoxes->boxes.size() < capacity ){
+            try{
+                freeBoxes->boxes.push_back(box);
+                return;
+            } catch(...){}
+        }
+        releaseBox(box);
+    }
+
+    //! Allocate memory for a box, the aligned operator new is only used for over-aligned types
+    static void * newBox(){
+        if constexpr( alignof(Type) > __STDCPP_DEFAULT_NEW_ALIGNMENT__ ){
+            return ::operator new(sizeof(Type), std::align_val_t(alignof(Type)));
+        } else {
+            return ::operator new(sizeof(Type));
+        }
+    }
+
+    //! Free the memory of a box allocated by `newBox`
+    static void releaseBox(void * box) noexcept {
+        if constexpr( alignof(Type) > __STDCPP_DEFAULT_NEW_ALIGNMENT__ ){
+            ::operator delete(box, sizeof(Type), std::align_val_t(alignof(Type)));
+        } else {
+            ::operator delete(box, sizeof(Type));
+        }
+    }
+};
+
+} // namespace
+
+//! A 16 byte storage of the objects held by GeneralTypes of type `GenType`
+template<typename GenType>
+class BasicCompactGeneralType;
+
+template<typename ErrorPolicy, typename ... Types_>
+class BasicCompactGeneralType<BasicGeneralType<ErrorPolicy,Types_...>> {
+    protected:
+    using GenType = BasicGeneralType<ErrorPolicy,Types_...>;
+    using Variant = typename GenType::Variant;
+
+    static constexpr std::size_t numberOfAlternatives = GenType::numberOfAlternatives;
+    static_assert(numberOfAlternatives <= 256, "The index of the alternative is stored in a single byte");
+
+    //! Index of the alternative `Type`, `numberOfAlternatives` if `Type` is no alternative
+    template<typename Type>
+    static constexpr std::size_t indexOf = indexOfType<Type, long int, Types_...>();
+
+    template<std::size_t Index>
+    using Alternative = std::variant_alternative_t<Index,Variant>;
+
+    //! If the objects of an alternative are boxed, inline objects are copied and destroyed without dispatch
+    static constexpr std::array<bool, numberOfAlternatives> isBoxed{ !isStoredInline<long int>, !isStoredInline<Types_>... };
+
+    public:
+    //! Holds the same value as a default constructed GeneralType
+    BasicCompactGeneralType() noexcept {
+        ::new(storage_.bytes) long int();
+    }
+
+    BasicCompactGeneralType(const BasicCompactGeneralType & compact){
+        static constexpr auto table = makeCopyTable(std::make_index_sequence<numberOfAlternatives>{});
+        if( !isBoxed[compact.index_] ){
+            storage_ = compact.storage_;
+            index_ = compact.index_;
+        } else {
+            table[compact.index_](*this, compact);
+        }
+    }
+
+    //! Take the value of `compact`, which holds the value of a default constructed GeneralType afterwards
+    BasicCompactGeneralType(BasicCompactGeneralType && compact) noexcept :
+        storage_(compact.storage_), index_(compact.index_)
+    {
+        compact.index_ = 0;
+        ::new(compact.storage_.bytes) long int();
+    }
+
+    //! Store the object held by `genT`
+    BasicCompactGeneralType(const GenType & genT){
+        static constexpr auto table = makeFromTable<const GenType &>(std::make_index_sequence<numberOfAlternatives>{});
+        table[checkedIndex(genT)](*this, genT);
+    }
+
+    //! Store the object held by `genT`, a boxed object is moved into the box
+    BasicCompactGeneralType(GenType && genT){
+        static constexpr auto table = makeFromTable<GenType &&>(std::make_index_sequence<numberOfAlternatives>{});
+        table[checkedIndex(genT)](*this, std::move(genT));
+    }
+
+    //! Store `value`, which has one of the types of `GenType`
+    template<typename Type>
+        requires( indexOf<std::remove_cvref_t<Type>> < numberOfAlternatives )
+    BasicCompactGeneralType(Type && value){
+        construct<indexOf<std::remove_cvref_t<Type>>>(std::forward<Type>(value));
+    }
+
+    ~BasicCompactGeneralType(){
+        destroy();
+    }
+
+    BasicCompactGeneralType & operator=(const BasicCompactGeneralType & compact){
+        if( this != &compact ){
+            *this = BasicCompactGeneralType(compact);
+        }
+        return *this;
+    }
+
+    BasicCompactGeneralType & operator=(BasicCompactGeneralType && compact) noexcept {
+        if( this != &compact ){
+            destroy();
+            storage_ = compact.storage_;
+            index_ = compact.index_;
+            compact.index_ = 0;
+            ::new(compact.storage_.bytes) long int();
+        }
+        return *this;
+    }
+
+    //! Store `value`, a GeneralType or one of its types, instead of the current object
+    template<typename Type>
+        requires( std::is_same_v<std::remove_cvref_t<Type>,GenType> || indexOf<std::remove_cvref_t<Type>> < numberOfAlternatives )
+    BasicCompactGeneralType & operator=(Type && value){
+        return *this = BasicCompactGeneralType(std::forward<Type>(value));
+    }
+
+    //! A GeneralType holding a copy of the stored object
+    operator GenType() const & {
+        static constexpr auto table = makeToTable<const BasicCompactGeneralType &>(std::make_index_sequence<numberOfAlternatives>{});
+        return table[index_](*this);
+    }
+
+    //! A GeneralType holding the stored object, boxed objects are moved out of their box
+    operator GenType() && {
+        static constexpr auto table = makeToTable<BasicCompactGeneralType &&>(std::make_index_sequence<numberOfAlternatives>{});
+        return table[index_](std::move(*this));
+    }
+
+    //! Index of the type of the stored object, the same as in `GenType`
+    std::size_t index() const noexcept {
+        return index_;
+    }
+
+    //! Check if the stored object has the type `Type`
+    template<typename Type>
+    bool holds() const noexcept {
+        return index_ == indexOf<Type>;
+    }
+
+    //! The stored object, throws a `std::bad_variant_access` if it has another type than `Type`
+    template<typename Type>
+        requires( indexOf<Type> < numberOfAlternatives )
+    Type & get(){
+        if( index_ != indexOf<Type> ){
+            throw std::bad_variant_access();
+        }
+        return access<indexOf<Type>>();
+    }
+
+    template<typename Type>
+        requires( indexOf<Type> < numberOfAlternatives )
+    const Type & get() const {
+        if( index_ != indexOf<Type> ){
+            throw std::bad_variant_access();
+        }
+        return access<indexOf<Type>>();
+    }
+
+    //! Reference the stored object to apply the operators of `GenType` to it
+    friend GeneralTypeRef<GenType> borrow(BasicCompactGeneralType & compact){
+        static constexpr auto table = makeReferenceTable<false>(std::make_index_sequence<numberOfAlternatives>{});
+        return table[compact.index_](compact);
+    }
+
+    //! Reference the stored object read only
+    friend GeneralTypeView<GenType> borrow(const BasicCompactGeneralType & compact){
+        static constexpr auto table = makeReferenceTable<true>(std::make_index_sequence<numberOfAlternatives>{});
+        return table[compact.index_](compact);
+    }
+
+    //! Temporaries can not be borrowed, the reference would dangle
+    friend void borrow(const BasicCompactGeneralType && compact) = delete;
+
+    //! Write the stored object like the GeneralType holding it
+    friend std::ostream & operator<<(std::ostream & os, const BasicCompactGeneralType & compact){
+        return os << borrow(compact);
+    }
+
+    protected:
+    static std::size_t checkedIndex(const GenType & genT){
+        if( genT.obj_.valueless_by_exception() ) [[unlikely]] {
+            throw std::bad_variant_access();
+        }
+        return genT.obj_.index();
+    }
+
+    //! The stored object of the alternative `Index`, which has to be the stored one
+    template<std::size_t Index>
+    Alternative<Index> & access() noexcept {
+        if constexpr( isStoredInline<Alternative<Index>> ){
+            return *std::launder(reinterpret_cast<Alternative<Index> *>(storage_.bytes));
+        } else {
+            return *static_cast<Alternative<Index> *>(storage_.box);
+        }
+    }
+
+    template<std::size_t Index>
+    const Alternative<Index> & access() const noexcept {
+        return const_cast<BasicCompactGeneralType *>(this)->template access<Index>();
+    }
+
+    //! Construct an object of the alternative `Index` from `arguments`, no object may be stored
+    template<std::size_t Index, typename ... Arguments>
+    void construct(Arguments && ... arguments){
+        if constexpr( isStoredInline<Alternative<Index>> ){
+            ::new(storage_.bytes) Alternative<Index>(std::forward<Arguments>(arguments)...);
+        } else {
+            storage_.box = BoxPool<Alternative<Index>>::create(std::forward<Arguments>(arguments)...);
+        }
+        index_ = Index;
+    }
+
+    //! Destroy the stored object, boxes are returned to the pool
+    void destroy() noexcept {
+        static constexpr auto table = makeDestroyTable(std::make_index_sequence<numberOfAlternatives>{});
+        if( isBoxed[index_] ){
+            table[index_](*this);
+        }
+    }
+
+    //! Table entry of `destroy` for the alternative `Index`
+    template<std::size_t Index>
+    static void destroyEntry(BasicCompactGeneralType & compact) noexcept {
+        if constexpr( !isStoredInline<Alternative<Index>> ){
+            BoxPool<Alternative<Index>>::destroy(static_cast<Alternative<Index> *>(compact.storage_.box));
+        }
+    }
+
+    template<std::size_t ... Indices>
+    static constexpr auto makeDestroyTable(std::index_sequence<Indices...>){
+        using Entry = void (*)(BasicCompactGeneralType &) noexcept;
+        return std::array<Entry, sizeof...(Indices)>{ &destroyEntry<Indices>... };
+    }
+
+    //! Table entry of the copy constructor for the alternative `Index`
+    template<std::size_t Index>
+    static void copyEntry(BasicCompactGeneralType & target, const BasicCompactGeneralType & source){
+        target.template construct<Index>(source.template access<Index>());
+    }
+
+    template<std::size_t ... Indices>
+    static constexpr auto makeCopyTable(std::index_sequence<Indices...>){
+        using Entry = void (*)(BasicCompactGeneralType &, const BasicCompactGeneralType &);
+        return std::array<Entry, sizeof...(Indices)>{ &copyEntry<Indices>... };
+    }
+
+    //! Table entry of the constructors from a GeneralType for the alternative `Index`
+    template<typename Source, std::size_t Index>
+    static void fromEntry(BasicCompactGeneralType & target, Source genT){
+        target.template construct<Index>(std::get<Index>(std::forward<Source>(genT).obj_));
+    }
+
+    template<typename Source, std::size_t ... Indices>
+    static constexpr auto makeFromTable(std::index_sequence<Indices...>){
+        using Entry = void (*)(BasicCompactGeneralType &, Source);
+        return std::array<Entry, sizeof...(Indices)>{ &fromEntry<Source,Indices>... };
+    }
+
+    //! Table entry of the conversions to a GeneralType for the alternative `Index`
+    template<typename Source, std::size_t Index>
+    static GenType toEntry(Source compact){
+        GenType genT;
+        if constexpr( std::is_rvalue_reference_v<Source> ){
+            genT.obj_.template emplace<Index>(std::move(compact.template access<Index>()));
+        } else {
+            genT.obj_.template emplace<Index>(compact.template access<Index>());
+        }
+        return genT;
+    }
+
+    template<typename Source, std::size_t ... Indices>
+    static constexpr auto makeToTable(std::index_sequence<Indices...>){
+        using Entry = GenType (*)(Source);
+        return std::array<Entry, sizeof...(Indices)>{ &toEntry<Source,Indices>... };
+    }
+
+    //! Table entry of `borrow` for the alternative `Index`
+    template<bool Const, std::size_t Index>
+    static BasicGeneralTypeRef<GenType,Const> referenceEntry(
+        std::conditional_t<Const, const BasicCompactGeneralType &, BasicCompactGeneralType &> compact)
+    {
+        return BasicGeneralTypeRef<GenType,Const>(compact.template access<Index>());
+    }
+
+    template<bool Const, std::size_t ... Indices>
+    static constexpr auto makeReferenceTable(std::index_sequence<Indices...>){
+        using Entry = BasicGeneralTypeRef<GenType,Const> (*)(
+            std::conditional_t<Const, const BasicCompactGeneralType &, BasicCompactGeneralType &>
+        );
+        return std::array<Entry, sizeof...(Indices)>{ &referenceEntry<Const,Indices>... };
+    }
+
+    //! The inline object or the pointer to the box holding it
+    union Storage {
+        alignas(8) std::byte bytes[8];
+        void * box;
+    };
+
+    Storage storage_;
+    std::uint8_t index_ = 0;
+}; // BasicCompactGeneralType<GenType>
+
+//! A 16 byte storage of the objects held by a `GeneralType<Types_...>`
+template<typename ... Types_>
+using CompactGeneralType = BasicCompactGeneralType<GeneralType<Types_...>>;
+
+//! A 16 byte storage of the objects held by a `StrictGeneralType<Types_...>`
+template<typename ... Types_>
+using StrictCompactGeneralType = BasicCompactGeneralType<StrictGeneralType<Types_...>>;
@@ -0,0 +1,239 @@
+#pragma once
+
+#include "GeneralDict.hpp"
+
+#include<array>
+#include<cstddef>
+#include<initializer_list>
+#include<mutex>
+#include<optional>
+#include<shared_mutex>
+#include<string>
+#include<string_view>
+#include<utility>
+
+/*!
+ * A dictionary mapping strings to `GeneralType`s that is shared by several threads.
+ * The entries are distributed over `NumberOfShards` shards by the hash of their key, every shard is a
+ * `GeneralDict` guarded by its own reader-writer lock. Readers of a shard do not block each other,
+ * a writer only blocks the shard of its key and lookups of different keys rarely meet at the same shard.
+ *
+ * A reference into the dictionary would outlive the lock of its shard, so values are returned by copy
+ * (`get`) or passed to a function while the shard is locked (`visit`, `modify`). `snapshot` and
+ * `for_each` lock all shards at once, they see every write either completely or not at all.
+ * The functions passed to `visit`, `modify` and `for_each` must not access the dictionary themselves.
+ */
+template<typename ErrorPolicy, std::size_t NumberOfShards, typename ... Types_>
+class BasicConcurrentGeneralDict{
+    static_assert(NumberOfShards > 0 && NumberOfShards <= 256 && (NumberOfShards & (NumberOfShards - 1)) == 0,
+        "The number of shards has to be a power of two of at most 256");
+
+    public:
+    //! The type of the keys
+    using key_type = std::string;
+
+    //! The type of the values
+    using mapped_type = BasicGeneralType<ErrorPolicy, Types_...>;
+
+    //! The dictionary of a single shard, also returned by `snapshot`
+    using Dict = BasicGeneralDict<ErrorPolicy, false, Types_...>;
+
+    protected:
+    //! A part of the entries and its lock. Every shard fills its own cache lines, such that
+    //! locking one shard does not invalidate the lock of another one.
+    struct alignas(64) Shard {
+        mutable std::shared_mutex mutex;
+        Dict dict;
+    };
+
+    public:
+    //! Default-construct an empty dictionary
+    BasicConcurrentGeneralDict() = default;
+
+    //! Construct a dictionary from a list of key value pairs, later duplicates overwrite earlier ones
+    BasicConcurrentGeneralDict(std::initializer_list<std::pair<std::string_view, mapped_type>> values){
+        for(const auto & [key,value]: values){
+            insert_or_assign(key, value);
+        }
+    }
+
+    BasicConcurrentGeneralDict(const BasicConcurrentGeneralDict &) = delete;
+    BasicConcurrentGeneralDict & operator=(const BasicConcurrentGeneralDict &) = delete;
+
+    //! Number of entries, entries inserted or erased at the same time may or may not be counted
+    std::size_t size() const {
+        std::size_t count = 0;
+        for(const Shard & shard: shards_){
+            std::shared_lock lock(shard.mutex);
+            count += shard.dict.size();
+        }
+        return count;
+    }
+
+    //! Check if there are no entries
+    bool empty() const {
+        return size() == 0;
+    }
+
+    //! Check if there is an entry with the key `key`
+    bool contains(std::string_view key) const {
+        return contains(DictKey(key));
+    }
+
+    //! Check if there is an entry with the precomputed key `key`
+    bool contains(DictKey key) const {
+        const Shard & shard = shardOf(key);
+        std::shared_lock lock(shard.mutex);
+        return shard.dict.contains(key);
+    }
+
+    //! A copy of the value of `key`, an empty optional if there is none
+    std::optional<mapped_type> get(std::string_view key) const {
+        return get(DictKey(key));
+    }
+
+    //! A copy of the value of the precomputed key `key`, an empty optional if there is none
+    std::optional<mapped_type> get(DictKey key) const {
+        const Shard & shard = shardOf(key);
+        std::shared_lock lock(shard.mutex);
+        const auto entry = shard.dict.find(key);
+        if( entry == shard.dict.end() ){
+            return std::nullopt;
+        }
+        return std::optional<mapped_type>(std::in_place, entry->second);
+    }
+
+    //! Call `function` with the value of `key` while its shard is locked for reading, e.g. to read
+    //! an element of a held vector without copying it. Returns false if there is no entry with the key.
+    template<typename Function>
+    bool visit(std::string_view key, Function && function) const {
+        return visit(DictKey(key), std::forward<Function>(function));
+    }
+
+    //! Call `function` with the value of the precomputed key `key` while its shard is locked for reading.
+    //! Returns false if there is no entry with the key.
+    template<typename Function>
+    bool visit(DictKey key, Function && function) const {
+        const Shard & shard = shardOf(key);
+        std::shared_lock lock(shard.mutex);
+        const auto entry = shard.dict.find(key);
+        if( entry == shard.dict.end() ){
+            return false;
+        }
+        std::forward<Function>(function)(std::as_const(entry->second));
+        return true;
+    }
+
+    //! Call `function` with the value of `key` while its shard is locked for writing, e.g. to increment
+    //! a counter without losing concurrent increments. A default constructed value is inserted if there is none.
+    template<typename Function>
+    decltype(auto) modify(std::string_view key, Function && function){
+        return modify(DictKey(key), std::forward<Function>(function));
+    }
+
+    //! Call `function` with the value of the precomputed key `key` while its shard is locked for writing.
+    //! A default constructed value is inserted if there is none.
+    template<typename Function>
+    decltype(auto) modify(DictKey key, Function && function){
+        Shard & shard = shardOf(key);
+        std::unique_lock lock(shard.mutex);
+        return std::forward<Function>(function)(shard.dict[key]);
+    }
+
+    //! Insert a value constructed from `args` if there is no entry with the key `key`.
+    //! Returns whether the value was inserted.
+    template<typename ... Args>
+    bool try_emplace(std::string_view key, Args && ... args){
+        Shard & shard = shardOf(DictKey(key));
+        std::unique_lock lock(shard.mutex);
+        return shard.dict.try_emplace(key, std::forward<Args>(args)...).second;
+    }
+
+    //! Assign `value` to `key`, inserting it if there is no entry with the key.
+    //! Returns whether the value was inserted.
+    template<typename Value>
+    bool insert_or_assign(std::string_view key, Value && value){
+        Shard & shard = shardOf(DictKey(key));
+        std::unique_lock lock(shard.mutex);
+        return shard.dict.insert_or_assign(key, std::forward<Value>(value)).second;
+    }
+
+    //! Remove the entry with the key `key`, returns the number of removed entries
+    std::size_t erase(std::string_view key){
+        Shard & shard = shardOf(DictKey(key));
+        std::unique_lock lock(shard.mutex);
+        return shard.dict.erase(key);
+    }
+
+    //! Remove all entries, no other thread sees a partially cleared dictionary
+    void clear(){
+        std::array<std::unique_lock<std::shared_mutex>, NumberOfShards> locks;
+        for(std::size_t i = 0; i < NumberOfShards; ++i){
+            locks[i] = std::unique_lock(shards_[i].mutex);
+        }
+        for(Shard & shard: shards_){
+            shard.dict.clear();
+        }
+    }
+
+    //! Call `function` with every key and value while all shards are locked for reading.
+    //! The entries are visited shard by shard, in insertion order within a shard.
+    template<typename Function>
+    void for_each(Function && function) const {
+        const auto locks = lockAllShared();
+        for(const Shard & shard: shards_){
+            for(const auto & [key,value]: shard.dict){
+                function(std::string_view(key), value);
+            }
+        }
+    }
+
+    //! A copy of all entries taken while all shards are locked for reading, i.e. a consistent state
+    //! of the dictionary that can be iterated without locking
+    Dict snapshot() const {
+        const auto locks = lockAllShared();
+        std::size_t count = 0;
+        for(const Shard & shard: shards_){
+            count += shard.dict.size();
+        }
+        Dict result;
+        result.reserve(count);
+        for(const Shard & shard: shards_){
+            for(const auto & [key,value]: shard.dict){
+                result.try_emplace(key, value);
+            }
+        }
+        return result;
+    }
+
+    protected:
+    //! The shard of `key`. Bits 24 to 31 of the hash select the shard, the dictionaries of the shards use
+    //! the lower bits for the position of a key and the upper 32 bits as its fingerprint.
+    const Shard & shardOf(DictKey key) const {
+        return shards_[(key.hash() >> 24) & (NumberOfShards - 1)];
+    }
+
+    Shard & shardOf(DictKey key){
+        return shards_[(key.hash() >> 24) & (NumberOfShards - 1)];
+    }
+
+    //! Lock all shards for reading. Always locking in the order of the shards prevents a deadlock
+    //! with `clear`, every other writer locks a single shard.
+    std::array<std::shared_lock<std::shared_mutex>, NumberOfShards> lockAllShared() const {
+        std::array<std::shared_lock<std::shared_mutex>, NumberOfShards> locks;
+        for(std::size_t i = 0; i < NumberOfShards; ++i){
+            locks[i] = std::shared_lock(shards_[i].mutex);
+        }
+        return locks;
+    }
+
+    std::array<Shard, NumberOfShards> shards_;
+}; // BasicConcurrentGeneralDict<ErrorPolicy,NumberOfShards,Types_...>
+
+//! A dictionary mapping strings to `GeneralType<Types_...>` that is shared by several threads
+template<typename ... Types_>
+using ConcurrentGeneralDict = BasicConcurrentGeneralDict<RuntimeErrorPolicy, 64, Types_...>;
+
+//! A dictionary mapping strings to `StrictGeneralType<Types_...>` that is shared by several threads
+template<typename ... Types_>
+using StrictConcurrentGeneralDict = BasicConcurrentGeneralDict<StrictErrorPolicy, 64, Types_...>;
@@ -0,0 +1,57 @@
+#include "../AtomicGeneralType.hpp"
+#include <thread>
+#include <vector>
+
+typedef GeneralType<
+    bool, int, double
+> GenType;
+
+typedef AtomicGeneralType<
+    bool, int, double
+> AtomicGenType;
+
+int main(){
+    /*!
+     * An `AtomicGeneralType` stores a value of a GeneralType with small trivially copyable types and updates it
+     * without a lock. The value and the index of its type take a 16 byte double word. Types like `std::string`
+     * do not fit and are rejected at compile time:
+     *     AtomicGeneralType<int, std::string> counter;  // error: static assertion failed
+     * */
+    std::cout << "sizeof(AtomicGenType) = " << sizeof(AtomicGenType) << ", lock-free: " << AtomicGenType::is_always_lock_free << std::endl;
+
+    //! load, store and exchange read and replace the value as a whole, including its type
+    AtomicGenType value = GenType(1);
+    std::cout << "load: " << value.load() << std::endl;
+    value.store(GenType(2.5));
+    std::cout << "exchange returns: " << value.exchange(GenType(true)) << ", now: " << value.load() << std::endl;
+
+    //! compare_exchange replaces the value only if it still equals the expected one, else loads the current value
+    GenType expected = GenType(false);
+    const bool exchanged = value.compare_exchange_strong(expected, GenType(3));
+    std::cout << "exchanged: " << exchanged << ", expected now: " << expected << std::endl;
+    std::cout << "exchanged: " << value.compare_exchange_strong(expected, GenType(3)) << ", now: " << value.load() << std::endl;
+
+    /*!
+     * fetch_add applies the operator+ of the GeneralType in a compare-and-swap loop, so no increment is lost
+     * when several threads count at once. The threads below add 10000 ones each.
+     * */
+    AtomicGenType counter = GenType(0);
+    std::vector<std::thread> threads;
+    for(int t = 0; t < 4; ++t){
+        threads.emplace_back([&]{
+            for(int i = 0; i < 10000; ++i){
+                counter.fetch_add(GenType(1));
+            }
+        });
+    }
+    for(std::thread & thread: threads){ thread.join(); }
+    std::cout << "counter: " << counter.load() << std::endl;
+
+    //! The result has the type operator+ returns, like `+=` an int counter becomes a double
+    std::cout << "fetch_add(0.5) returns " << counter.fetch_add(GenType(0.5)) << ", now: " << counter.load() << std::endl;
+
+    //! Every value of every type is stored, e.g. the full range of the `long int` of a default constructed value
+    AtomicGenType large;
+    large.fetch_add(GenType(1L << 50));
+    std::cout << "large: " << large.load() << std::endl;
+}
@@ -45,6 +45,19 @@ int main(int argc, char** argv){
     // print new content
     std::cout << "VAR Holding double: " << VAR << std::endl;
 
+    /*!
+     * If the held type is known, it can be accessed without conversion:
+     * `get_if<Type>()` returns a pointer or `nullptr`, `get<Type>()` a reference or throws a
+     * `std::bad_variant_access`, `get_unchecked<Type>()` a reference without any check in release builds.
+     * `visit` calls a function with the held object.
+     * */
+    if( double * held = VAR.get_if<double>() ){
+        *held *= 2;
+    }
+    std::cout << "VAR doubled: " << VAR.get<double>() << std::endl;
+    VECTOR_D.get_unchecked<std::vector<double>>().push_back(11);
+    VECTOR_D.visit([](const auto & held){ std::cout << "VECTOR_D holds " << typeToString<std::remove_cvref_t<decltype(held)>>() << std::endl; });
+
     /*!
      * The usage of the class should be as easy as possible. 
      * So if possible we don't want to cast the `GenType` to it's held type. 
@@ -136,33 +149,40 @@ int main(int argc, char** argv){
     //! * Inequality Operator `operator=! -> GenType`
     DOUBLE != DOUBLE;
 
-    //! * Add assign Operator `operator+= -> GenType`
+    //! * Add assign Operator `operator+= -> GenType&`
     DOUBLE += DOUBLE;
 
-    //! * Subtract assign Operator `operator-= -> GenType`
+    //! * Subtract assign Operator `operator-= -> GenType&`
     DOUBLE -= INT;
 
-    //! * Multiply assign Operator `operator*= -> GenType`
+    //! * Multiply assign Operator `operator*= -> GenType&`
     DOUBLE *= DOUBLE;
 
-    //! * Division assign Operator `operator/= -> GenType`
+    //! * Division assign Operator `operator/= -> GenType&`
     DOUBLE /= DOUBLE;
     
-    //! * Modulus Operator `operator%= -> GenType`
+    //! * Modulus Operator `operator%= -> GenType&`
     INT %= INT;
 
-    //! * Bitwise AND assign Operator `operator&= -> GenType`
+    //! * Bitwise AND assign Operator `operator&= -> GenType&`
     BOOL &= BOOL;
 
-    //! * Bitwise inclusive OR assign Operator `operator|= -> GenType`
+    //! * Bitwise inclusive OR assign Operator `operator|= -> GenType&`
     BOOL |= BOOL;
     
-    //! * Bitwise exclusive OR assign Operator `operator^= -> GenType`
+    //! * Bitwise exclusive OR assign Operator `operator^= -> GenType&`
     BOOL ^= BOOL;
 
-    //! * Right shift assign Operator `operator>>= -> GenType`
+    //! * Right shift assign Operator `operator>>= -> GenType&`
     INT >>= INT;
 
+    /*! Compound assignments modify the held object in place. If the result of the
+     * operator has a wider type, e.g. `int + double`, the GenType holds it afterwards.
+     * */
+    GenType PROMOTED = 2;
+    PROMOTED += DOUBLE;
+    std::cout << "int += double holds a double: " << PROMOTED << std::endl;
+
     /*! In case a held type doesn't implement an operator, 
      * like the `std::vector` has no nativ `operator<<`, 
      * a runtime (!) error is thrown.
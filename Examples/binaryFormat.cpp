@@ -0,0 +1,63 @@
+#include "../BinaryFormat.hpp"
+#include <cstdio>
+#include <fstream>
+#include <map>
+
+typedef GeneralType<
+    bool, int, double, std::string, std::vector<double>
+> GenType;
+
+typedef GeneralDict<
+    bool, int, double, std::string, std::vector<double>
+> Dict;
+
+int main(){
+    Dict parameters;
+    parameters["verbose"] = true;
+    parameters["iterations"] = 100;
+    parameters["tolerance"] = 1e-8;
+    parameters["name"] = std::string("solver");
+    parameters["weights"] = std::vector<double>{0.25, 0.5, 0.25};
+
+    /*!
+     * `toBinary` stores a GenType or a dictionary in a compact binary format, which keeps the held
+     * type of every value. `fromBinary` reads it back. Vectors of numbers are copied as a whole.
+     * */
+    const std::vector<std::byte> data = toBinary(parameters);
+    std::cout << "Stored " << parameters.size() << " parameters in " << data.size() << " bytes" << std::endl;
+
+    const Dict restored = fromBinary<Dict>(data);
+    for(auto [key,value]: restored){
+        std::cout << std::boolalpha << key << ": ";
+        if( key == "weights" ){
+            for(double weight: std::vector<double>(GenType(value))){ std::cout << weight << " "; }
+            std::cout << std::endl;
+        } else {
+            std::cout << value << std::endl;
+        }
+    }
+    std::cout << "Round trip is identical: " << (toBinary(restored) == data) << std::endl;
+
+    //! Dictionaries can be read into a std::map and single GenTypes are stored as well
+    const std::map<std::string,GenType> map = fromBinary<std::map<std::string,GenType>>(data);
+    std::cout << "tolerance from std::map: " << map.at("tolerance") << std::endl;
+    std::cout << "single GenType: " << fromBinary<GenType>(toBinary(GenType(42))) << std::endl;
+
+    //! Files are written and read with `writeBinary` and `readBinary`
+    {
+        std::ofstream file("parameters.bin", std::ios::binary);
+        writeBinary(file, parameters);
+    }
+    {
+        std::ifstream file("parameters.bin", std::ios::binary);
+        std::cout << "name from file: " << readBinary<Dict>(file).at("name") << std::endl;
+    }
+    std::remove("parameters.bin");
+
+    //! Data written by a GenType with different types is rejected
+    try{
+        fromBinary<GeneralDict<int, double>>(data);
+    } catch(const std::runtime_error & e){
+        std::cout << "Caught: " << e.what() << std::endl;
+    }
+}
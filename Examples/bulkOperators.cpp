@@ -0,0 +1,45 @@
+#include "../GeneralType.hpp"
+#include <string>
+#include <vector>
+
+typedef GeneralType<
+    bool, int, double, std::string
+> GenType;
+
+int main(){
+    std::vector<GenType> lhs = { GenType(1), GenType(2.5), GenType(3), GenType(std::string("a")) };
+    std::vector<GenType> rhs = { GenType(0.5), GenType(2), GenType(4), GenType(std::string("b")) };
+    std::vector<GenType> result(lhs.size());
+
+    /*!
+     * The bulk operators apply an operator element wise to spans (or vectors) of GenTypes.
+     * The elements are grouped by the pair of held types and each group is computed in one loop,
+     * instead of dispatching every element on its own.
+     * */
+    add(lhs, rhs, result);
+    for(std::size_t i = 0; i < result.size(); ++i){
+        std::cout << lhs[i] << " + " << rhs[i] << " = " << result[i] << std::endl;
+    }
+
+    //! Comparisons store a bool in every element of the result
+    compareSmaller(lhs, rhs, result);
+    for(std::size_t i = 0; i < result.size(); ++i){
+        std::cout << std::boolalpha << lhs[i] << " < " << rhs[i] << ": " << result[i] << std::endl;
+    }
+
+    //! The result may be one of the operands
+    multiply(std::span(lhs).first(3), std::span(rhs).first(3), std::span(lhs).first(3));
+    std::cout << "lhs[0] * rhs[0] = " << lhs[0] << std::endl;
+
+    //! `convert_all<Type>` converts every element to `Type`, each run of equally typed elements in one loop
+    std::vector<double> numbers(3);
+    convert_all<double>(std::span(rhs).first(3), numbers);
+    std::cout << "rhs as doubles: " << numbers[0] << " " << numbers[1] << " " << numbers[2] << std::endl;
+
+    //! Operators not defined for the held types throw just like for a single GenType
+    try{
+        divide(lhs, rhs, result);
+    } catch(const std::runtime_error & e){
+        std::cout << "Caught: " << e.what() << std::endl;
+    }
+}
@@ -0,0 +1,48 @@
+#include "../CompactGeneralType.hpp"
+#include <map>
+#include <string>
+#include <vector>
+
+typedef GeneralType<
+    bool, int, double, std::string, std::vector<double>
+> GenType;
+
+typedef CompactGeneralType<
+    bool, int, double, std::string, std::vector<double>
+> Compact;
+
+int main(){
+    /*!
+     * A `CompactGeneralType` stores the same values as its GeneralType in 16 bytes. `bool`, `int` and
+     * `double` are stored inline, the string and the vector in a box on the heap.
+     * */
+    std::cout << "sizeof(GenType): " << sizeof(GenType) << ", sizeof(Compact): " << sizeof(Compact) << std::endl;
+
+    std::vector<Compact> values;
+    values.push_back(1);
+    values.push_back(2.5);
+    values.push_back(std::string("three"));
+    values.push_back(GenType(std::vector<double>{4.0, 4.5}));
+
+    //! The stored object can be read directly ...
+    std::cout << "values[1]: " << values[1].get<double>() << std::endl;
+    std::cout << "values[2] holds a string: " << std::boolalpha << values[2].holds<std::string>() << std::endl;
+
+    //! ... or referenced by `borrow` to use the operators of the GeneralType without copying it
+    std::cout << "values[0] + values[1]: " << borrow(values[0]) + borrow(values[1]) << std::endl;
+    borrow(values[2]) += std::string(" and four");
+    borrow(values[3]) *= 2.0;
+    std::cout << "values[2]: " << values[2] << std::endl;
+
+    //! Converting to the GeneralType copies the stored object, converting a temporary moves it
+    GenType vector = std::move(values[3]);
+    std::cout << "vector[1]: " << vector[1] << std::endl;
+
+    //! Assigning a GeneralType or a value of one of the types replaces the stored object
+    values[2] = GenType(false);
+    std::cout << "values[2]: " << values[2] << std::endl;
+
+    //! Maps of compact values are denser as well
+    std::map<std::string,Compact> parameters{{"iterations", 100}, {"name", std::string("solver")}};
+    std::cout << "name: " << parameters.at("name") << std::endl;
+}
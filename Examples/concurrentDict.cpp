@@ -0,0 +1,79 @@
+#include "../ConcurrentGeneralDict.hpp"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+typedef GeneralType<
+    bool, int, double, std::string, std::vector<double>
+> GenType;
+
+typedef ConcurrentGeneralDict<
+    bool, int, double, std::string, std::vector<double>
+> Dict;
+
+int main(){
+    /*!
+     * A `ConcurrentGeneralDict` is shared by several threads without an outer mutex. Its entries
+     * are split into shards with a reader-writer lock each, so readers only wait for writers of the same shard.
+     * */
+    Dict parameters = {{"iterations", 100}, {"tolerance", 1e-8}, {"name", std::string("solver")}};
+
+    //! Values are returned by copy, references would outlive the lock of their shard
+    std::cout << "tolerance: " << parameters.get("tolerance").value() << std::endl;
+    std::cout << "has restart: " << std::boolalpha << parameters.get("restart").has_value() << std::endl;
+
+    //! Large values are read in place by `visit`, which calls a function while the shard is locked
+    parameters.insert_or_assign("weights", std::vector<double>{0.25, 0.5, 0.25});
+    parameters.visit("weights", [](const GenType & weights){ std::cout << "weights[1]: " << weights[1] << std::endl; });
+
+    /*!
+     * Several threads hammer the dictionary at the same time. `modify` changes a value while its shard
+     * is locked for writing, thus no increment of the shared counter is lost.
+     * */
+    constexpr int numberOfThreads = 8;
+    constexpr int increments = 10000;
+    std::vector<std::thread> threads;
+    for(int t = 0; t < numberOfThreads; ++t){
+        threads.emplace_back([&parameters,t]{
+            const std::string own = "thread" + std::to_string(t);
+            for(int i = 0; i < increments; ++i){
+                parameters.modify("counter", [](GenType & counter){ counter += GenType(1); });
+                parameters.insert_or_assign(own, i);
+            }
+        });
+    }
+    for(std::thread & thread: threads){ thread.join(); }
+    std::cout << "counter: " << parameters.get("counter").value()
+              << " (expected " << numberOfThreads * increments << ")" << std::endl;
+
+    /*!
+     * `snapshot` copies all entries while all shards are locked at once. A writer inserts the keys
+     * `step0`, `step1`, ... one after the other, so every snapshot holds the steps 0 to n without a gap,
+     * although the steps are spread over all shards.
+     * */
+    std::atomic<bool> done = false;
+    std::thread writer([&]{
+        for(int step = 0; step < 20000; ++step){
+            parameters.insert_or_assign("step" + std::to_string(step), step);
+        }
+        done = true;
+    });
+    std::size_t snapshots = 0, inconsistent = 0;
+    while( !done ){
+        const Dict::Dict snapshot = parameters.snapshot();
+        std::size_t steps = 0;
+        while( snapshot.contains("step" + std::to_string(steps)) ){ ++steps; }
+        // no step after the first missing one may be contained
+        for(const auto & [key,value]: snapshot){
+            if( key.starts_with("step") && std::stoul(key.substr(4)) >= steps ){ ++inconsistent; }
+        }
+        ++snapshots;
+    }
+    writer.join();
+    std::cout << "snapshots: " << (snapshots > 0 ? "taken" : "none") << ", inconsistent: " << inconsistent << std::endl;
+
+    //! `for_each` visits all entries under the same locks without copying them
+    std::size_t count = 0;
+    parameters.for_each([&count](std::string_view, const GenType &){ ++count; });
+    std::cout << "entries: " << count << " = " << parameters.size() << std::endl;
+}
@@ -1,4 +1,4 @@
-#include "../GeneralType.hpp"
+#include "../GeneralDict.hpp"
 #include<map>
 
 typedef GeneralType<
@@ -7,6 +7,10 @@ typedef GeneralType<
 
 typedef std::map<std::string,GenType> Dict;
 
+typedef GeneralDict<
+    bool, int, double, std::string
+> FastDict;
+
 int main(){
     /*!
      * A main motivation of this class is to implement a dictionary that is able to hold arbitrary
@@ -45,4 +49,31 @@ int main(){
         std::cout << std::boolalpha << key << ": " << value << std::endl;
     }
 
+    /*!
+     * The `GeneralDict` provides the same interface as the std::map above, but stores the entries
+     * in a flat hash table. Keys are looked up by std::string_view without creating a std::string
+     * and the entries are visited in insertion order.
+     * */
+    FastDict fastParameters = {{"key1", true}, {"key2", 1.235}, {"key3", 2}};
+    fastParameters["key4"] = fastParameters["key3"]*fastParameters["key2"];
+    fastParameters["key5"] = fastParameters.at("key3")*0.2;
+
+    std::string_view key = "key2";
+    if( fastParameters.contains(key) ){
+        std::cout << key << " is " << fastParameters.at(key) << std::endl;
+    }
+
+    /*!
+     * Parameters that are read repeatedly can be looked up without hashing the key: a `DictKey`
+     * created from a string literal carries its hash computed at compile time and a `Handle` returned
+     * by `intern` is the position of the entry. Handles stay valid until an entry is erased.
+     * */
+    constexpr DictKey key3 = "key3"_key;
+    const FastDict::Handle key4 = fastParameters.intern("key4");
+    std::cout << "key3 * key4: " << fastParameters[key3]*fastParameters[key4] << std::endl;
+
+    fastParameters.erase("key1");
+    for(auto [key,value]: fastParameters){
+        std::cout << std::boolalpha << key << ": " << value << std::endl;
+    }
 }
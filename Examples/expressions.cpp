@@ -0,0 +1,49 @@
+#include "../GeneralExpression.hpp"
+#include <vector>
+
+typedef GeneralType<
+    bool, int, double, std::vector<double>, std::string
+> GenType;
+
+//! Print a GenType holding a std::vector<double>
+void print(const char * name, GenType genT){
+    std::cout << name << ":";
+    for(double element: std::vector<double>(genT)){
+        std::cout << " " << element;
+    }
+    std::cout << std::endl;
+}
+
+int main(){
+    GenType INT = 2;
+    GenType DOUBLE = 1.5;
+    GenType OTHER_DOUBLE = 0.25;
+    GenType VECTOR = std::vector<double>{1.0, 2.0, 3.0, 4.0};
+    GenType OTHER_VECTOR = std::vector<double>{0.5, 0.5, 2.0, 8.0};
+    GenType STRING = std::string("pi");
+
+    /*!
+     * Every operator of a chain like `VECTOR * DOUBLE + OTHER_VECTOR` dispatches on the held types
+     * and creates an intermediate GenType. Starting the chain with `lazy` builds an expression
+     * instead, which is evaluated once it is converted to a GenType. If all operands hold the same
+     * numeric type or a std::vector of it the expression is computed in a single pass.
+     * */
+    GenType result = lazy(VECTOR) * DOUBLE + OTHER_VECTOR;
+    print("VECTOR * DOUBLE + OTHER_VECTOR", result);
+    print("VECTOR / OTHER_VECTOR - 1.0", lazy(VECTOR) / OTHER_VECTOR - 1.0);
+    std::cout << "DOUBLE * OTHER_DOUBLE + DOUBLE: " << GenType(lazy(DOUBLE) * OTHER_DOUBLE + DOUBLE) << std::endl;
+
+    //! Other operands fall back to the operators of the GenType
+    std::cout << "INT * DOUBLE - OTHER_DOUBLE: " << GenType(lazy(INT) * DOUBLE - OTHER_DOUBLE) << std::endl;
+    std::cout << "STRING + STRING: " << GenType(lazy(STRING) + STRING) << std::endl;
+    try{
+        GenType(lazy(STRING) - INT);
+    } catch(const std::runtime_error & e){
+        std::cout << "Caught: " << e.what() << std::endl;
+    }
+
+    /*!
+     * An expression references its GenType operands, hence it has to be evaluated before they are
+     * destroyed. Don't store expressions with `auto` beyond the lifetime of the operands.
+     * */
+}
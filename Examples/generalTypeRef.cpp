@@ -0,0 +1,54 @@
+#include "../GeneralTypeRef.hpp"
+#include <vector>
+
+typedef GeneralType<
+    bool, int, double, std::vector<double>, std::string
+> GenType;
+
+int main(){
+    GenType VECTOR = std::vector<double>{1.0, 2.0, 3.0};
+    GenType DOUBLE = 0.5;
+
+    /*!
+     * `VECTOR[1]` copies the element into a new GenType. `borrow(VECTOR)` returns a `GeneralTypeRef`,
+     * which references the held vector instead, and indexing it references the element.
+     * */
+    auto ref = borrow(VECTOR);
+    ref[1] += 10.0;                 // modifies the element of VECTOR in place
+    ref[2] = 7;                     // assigns to the element, converted to its type double
+    ++ref[0];
+    std::cout << "VECTOR[0], VECTOR[1], VECTOR[2]: " << VECTOR[0] << " " << VECTOR[1] << " " << VECTOR[2] << std::endl;
+
+    //! The other operators take GenTypes, references or plain values and return a new GenType
+    std::cout << "ref[1] * DOUBLE: " << ref[1] * DOUBLE << std::endl;
+    std::cout << "1.0 + ref[2]: " << 1.0 + ref[2] << std::endl;
+    std::cout << "ref[0] < ref[1]: " << std::boolalpha << (ref[0] < ref[1]) << std::endl;
+
+    //! Compound assignments on the whole vector work in place as well
+    ref *= 2.0;
+
+    //! The held vector can be read as a std::span without copying it
+    std::cout << "VECTOR:";
+    for(double element: ref.span<double>()){ std::cout << " " << element; }
+    std::cout << std::endl;
+
+    //! A const GenType is borrowed as a read only `GeneralTypeView`
+    const GenType & constVector = VECTOR;
+    GeneralTypeView<GenType> view = borrow(constVector);
+    std::cout << "view[2] holds a double: " << view[2].holds<double>() << ", value " << view[2].get<double>() << std::endl;
+
+    //! A reference never changes the type of the referenced object, assigning another type throws
+    try{
+        ref[0] = std::string("text");
+    } catch(const std::runtime_error & e){
+        std::cout << "Caught: " << e.what() << std::endl;
+    }
+
+    //! Numbers are not assigned to a string as a character either
+    GenType STRING = std::string("abc");
+    try{
+        borrow(STRING) = 65;
+    } catch(const std::runtime_error & e){
+        std::cout << "Caught: " << e.what() << ", STRING is still " << STRING << std::endl;
+    }
+}
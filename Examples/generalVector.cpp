@@ -0,0 +1,52 @@
+#include "../GeneralVector.hpp"
+#include <string>
+
+typedef GeneralType<
+    bool, int, double, std::string
+> GenType;
+
+typedef GeneralVector<
+    bool, int, double, std::string
+> GenVector;
+
+int main(){
+    /*!
+     * A GenVector stores many GenTypes column wise: each type has its own array and 
+     * consecutive elements of the same type form a run. Large tables of mostly equally 
+     * typed values are thus stored densely and operators dispatch once per run.
+     * */
+    GenVector values;
+    for(int i = 0; i < 5; ++i){
+        values.push_back(0.5*i);
+    }
+    values.push_back(7);
+    values.push_back(GenType(8));
+
+    //! The 5 doubles and 2 ints are stored in 2 runs
+    std::cout << "size: " << values.size() << ", runs: " << values.numberOfRuns() << std::endl;
+
+    //! Element access returns a GenType
+    GenType third = values[2];
+    std::cout << "values[2]: " << third << std::endl;
+
+    //! Elements can be reassigned, even with a different type
+    values[1] = std::string("one");
+    std::cout << "values[1]: " << values[1] << ", runs: " << values.numberOfRuns() << std::endl;
+    values[1] = 0.5;
+
+    //! Bulk operators apply the operator element wise, once per run
+    GenVector doubled = values * GenType(2);
+    GenVector sum = values + doubled;
+    GenVector isLarge = sum > GenType(5.0);
+    for(std::size_t i = 0; i < sum.size(); ++i){
+        std::cout << std::boolalpha << "sum[" << i << "] = " << sum[i] << " > 5: " << isLarge[i] << std::endl;
+    }
+
+    //! Operators not defined for the held types throw just like for a GenType
+    values[0] = std::string("zero");
+    try{
+        values - doubled;
+    } catch(const std::runtime_error & e){
+        std::cout << "Caught: " << e.what() << std::endl;
+    }
+}
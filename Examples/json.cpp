@@ -0,0 +1,75 @@
+#include "../JsonFormat.hpp"
+#include <sstream>
+
+typedef GeneralType<
+    bool, int, double, std::string, std::vector<int>, std::vector<double>, std::vector<std::string>
+> GenType;
+
+typedef GeneralDict<
+    bool, int, double, std::string, std::vector<int>, std::vector<double>, std::vector<std::string>
+> Dict;
+
+int main(){
+    /*!
+     * `fromJson` reads a JSON object into a dictionary in a single pass. Integers are stored as `int`,
+     * other numbers as `double`, arrays as vectors of the type of their elements.
+     * */
+    const std::string json = R"({
+        "verbose": true,
+        "iterations": 100,
+        "tolerance": 1e-8,
+        "name": "solver é",
+        "grid": [64, 64, 32],
+        "weights": [0.25, 0.5, 0.25],
+        "outputs": ["pressure", "velocity"],
+        "solver": { "preconditioner": "jacobi", "restart": 30 }
+    })";
+    Dict parameters = fromJson<Dict>(json);
+    std::cout << "Read " << parameters.size() << " parameters" << std::endl;
+    std::cout << "iterations: " << parameters["iterations"] << std::endl;
+    std::cout << "tolerance: " << parameters["tolerance"] << std::endl;
+    std::cout << "name: " << parameters["name"] << std::endl;
+
+    //! Members of nested objects are stored with their path as key
+    std::cout << "solver.restart: " << parameters["solver.restart"] << std::endl;
+
+    //! Arrays are held by vectors
+    std::cout << "grid:";
+    for(int size: std::vector<int>(GenType(parameters["grid"]))){ std::cout << " " << size; }
+    std::cout << std::endl;
+    std::cout << "outputs:";
+    for(const std::string & output: std::vector<std::string>(GenType(parameters["outputs"]))){ std::cout << " " << output; }
+    std::cout << std::endl;
+
+    //! Values are GeneralTypes, all operators work on them
+    std::cout << "2 * iterations: " << parameters["iterations"] * GenType(2) << std::endl;
+
+    //! Single values can be read into a GeneralType, whole streams by `readJson`
+    std::cout << "value: " << fromJson<GenType>("  3.5 ") << std::endl;
+    std::istringstream stream(R"({"a": 1, "b": "two"})");
+    std::cout << "from stream: " << readJson<Dict>(stream).size() << " entries" << std::endl;
+
+    /*!
+     * `toJson` writes GeneralTypes of any type, including vectors, and whole dictionaries as JSON. Appending to
+     * a string supplied by the caller reuses its memory, `indented` writes every entry on its own line.
+     * */
+    std::cout << toJson(parameters["weights"]) << std::endl;
+    std::string out;
+    toJson(parameters, out, true);
+    std::cout << out << std::endl;
+
+    //! Floating point numbers are written in their shortest form that reads back to the same value
+    parameters["tolerance"] = 0.1 + 0.2;
+    std::cout << "tolerance: " << toJson(parameters["tolerance"]) << std::endl;
+    const std::string written = toJson(parameters);
+    std::cout << "round trip: " << std::boolalpha << (toJson(fromJson<Dict>(written)) == written) << std::endl;
+
+    //! Invalid documents and values the GeneralType can not hold throw with the position of the error
+    for(const char * invalid: {R"({"a": 1,})", R"({"a": null})", R"({"a": [1, "b"]})"}){
+        try{
+            fromJson<Dict>(invalid);
+        } catch(const std::runtime_error & e){
+            std::cout << "Caught: " << e.what() << std::endl;
+        }
+    }
+}
@@ -0,0 +1,52 @@
+#include "../GeneralType.hpp"
+#include "../MemoryResource.hpp"
+#include <array>
+
+typedef GeneralType<
+    bool, int, double, ScopedString, ScopedVector<double>, ScopedVector<bool>
+> GenType;
+
+//! A memory resource that counts the allocations passed on to the heap
+struct CountingResource : std::pmr::memory_resource {
+    std::size_t allocations = 0;
+
+    void * do_allocate(std::size_t bytes, std::size_t alignment) override {
+        ++allocations;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    void do_deallocate(void * pointer, std::size_t bytes, std::size_t alignment) override {
+        std::pmr::new_delete_resource()->deallocate(pointer, bytes, alignment);
+    }
+    bool do_is_equal(const std::pmr::memory_resource & other) const noexcept override {
+        return this == &other;
+    }
+};
+
+int main(){
+    /*!
+     * The strings and vectors of the GenType use a `ScopedAllocator`. While a `MemoryResourceScope` is alive,
+     * all of them allocate from its memory resource, here a monotonic arena on a stack buffer. The results
+     * of the operators are allocated from the arena as well.
+     * */
+    std::array<std::byte, 4096> buffer;
+    CountingResource heap;
+    std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(), &heap);
+    {
+        MemoryResourceScope scope(arena);
+        GenType name = ScopedString("a request scoped string, too long for the small string buffer");
+        GenType values = ScopedVector<double>{1.0, 2.0, 3.0};
+
+        GenType greeting = name + name;
+        GenType scaled = (values + 1.0) * values;
+        GenType mask = scaled > 5.0;
+        std::cout << "greeting: " << greeting << std::endl;
+        std::cout << "scaled[2]: " << scaled[2] << ", mask[2]: " << mask[2] << std::endl;
+        std::cout << "heap allocations inside the scope: " << heap.allocations << std::endl;
+    }
+    //! All objects allocated in the arena are gone, its memory is freed at once
+    arena.release();
+
+    //! Outside of a scope the default memory resource is used
+    GenType name = ScopedString("allocated by the default memory resource, e.g. operator new");
+    std::cout << "name: " << name << std::endl;
+}
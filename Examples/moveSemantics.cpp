@@ -0,0 +1,64 @@
+#include "../GeneralType.hpp"
+#include <vector>
+
+//! A vector that counts how often it is copied and moved
+struct Field {
+    static inline int copies = 0;
+    static inline int moves = 0;
+
+    std::vector<double> values;
+
+    Field() = default;
+    explicit Field(std::size_t size, double value = 0) : values(size, value) {}
+    Field(const Field & other) : values(other.values) { ++copies; }
+    Field(Field && other) noexcept : values(std::move(other.values)) { ++moves; }
+    Field & operator=(const Field & other){ values = other.values; ++copies; return *this; }
+    Field & operator=(Field && other) noexcept { values = std::move(other.values); ++moves; return *this; }
+};
+
+std::ostream & operator<<(std::ostream & os, const Field & field){
+    return os << "Field(" << field.values.size() << ")";
+}
+
+typedef GeneralType<
+    int, double, Field, std::vector<double>
+> GenType;
+
+//! Print the copies and moves of `Field`s made by `function`
+template<typename Function>
+void count(const char * name, Function && function){
+    Field::copies = 0;
+    Field::moves = 0;
+    function();
+    std::cout << name << ": " << Field::copies << " copies, " << Field::moves << " moves" << std::endl;
+}
+
+int main(){
+    Field field(1000);
+
+    /*!
+     * Constructing and assigning a GenType copies l-values and moves r-values. If the GenType holds
+     * the assigned type already, the held object is assigned to and may reuse its memory.
+     * */
+    count("construct from l-value", [&]{ GenType value = field; });
+    count("construct from r-value", [&]{ GenType value = Field(1000); });
+    count("assign l-value", [&]{ GenType value; value = field; });
+    count("assign r-value", [&]{ GenType value; value = Field(1000); });
+    std::cout << "l-values are left untouched: " << field << std::endl;
+
+    /*!
+     * `emplace<Type>(args...)` constructs the object in place of the held one, without a temporary.
+     * Initializer lists are forwarded as well.
+     * */
+    count("emplace", [&]{ GenType value; value.emplace<Field>(1000, 1.0); });
+    GenType vector;
+    vector.emplace<std::vector<double>>({1.0, 2.0, 3.0});
+    std::cout << "emplaced vector: " << vector[0] << " " << vector[1] << " " << vector[2] << std::endl;
+
+    /*!
+     * `emplace_with<Type>(function, args...)` stores the object returned by `function(args...)`
+     * in place, e.g. a field computed by a factory is neither copied nor moved.
+     * */
+    auto makeField = [](std::size_t size){ return Field(size, 2.0); };
+    count("emplace_with", [&]{ GenType value; value.emplace_with<Field>(makeField, 1000); });
+}
@@ -0,0 +1,41 @@
+#include "../NanBoxedGeneralType.hpp"
+#include <vector>
+
+typedef GeneralType<
+    bool, int, double
+> GenType;
+
+typedef NanBoxedGeneralType<
+    bool, int, double
+> NanBoxed;
+
+int main(){
+    /*!
+     * A `NanBoxedGeneralType` stores the values of a GeneralType of scalars in 8 bytes: a double as is,
+     * `bool` and `int` in the payload of a NaN. Copying it copies a single 64 bit integer.
+     * */
+    std::cout << "sizeof(GenType): " << sizeof(GenType) << ", sizeof(NanBoxed): " << sizeof(NanBoxed) << std::endl;
+
+    std::vector<NanBoxed> values{1, 2.5, true, -7};
+    for(const NanBoxed & value: values){
+        std::cout << value << " holds a double: " << std::boolalpha << value.holds<double>() << std::endl;
+    }
+
+    //! Values are read by copy, the operators are applied to the GeneralType holding the value
+    std::cout << "values[1]: " << values[1].get<double>() << std::endl;
+    std::cout << "values[0] + values[1]: " << GenType(values[0]) + GenType(values[1]) << std::endl;
+    values[0] = GenType(values[0]) * GenType(10);
+    std::cout << "values[0]: " << values[0] << std::endl;
+
+    //! NaNs are stored as a quiet NaN, which is still a double
+    values[2] = std::nan("");
+    std::cout << "values[2] holds a double: " << values[2].holds<double>() << std::endl;
+
+    /*!
+     * `DenseGeneralType<GenType>` selects the NaN-boxed storage if all types of the GeneralType can be
+     * NaN-boxed and the 16 byte `CompactGeneralType` otherwise, e.g. for a GeneralType holding strings.
+     * */
+    typedef GeneralType<bool, int, double, std::string> GenTypeWithStrings;
+    std::cout << "sizeof(DenseGeneralType<GenType>): " << sizeof(DenseGeneralType<GenType>) << std::endl;
+    std::cout << "sizeof(DenseGeneralType<GenTypeWithStrings>): " << sizeof(DenseGeneralType<GenTypeWithStrings>) << std::endl;
+}
@@ -0,0 +1,91 @@
+#include "../Snapshot.hpp"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+typedef GeneralType<
+    bool, int, double, std::string, std::vector<double>, std::vector<bool>
+> GenType;
+
+typedef GeneralDict<
+    bool, int, double, std::string, std::vector<double>, std::vector<bool>
+> Dict;
+
+int main(){
+    Dict parameters;
+    parameters["verbose"] = true;
+    parameters["iterations"] = 100;
+    parameters["tolerance"] = 1e-8;
+    parameters["name"] = std::string("solver");
+    parameters["weights"] = std::vector<double>{0.25, 0.5, 0.25};
+    parameters["mask"] = std::vector<bool>{true, false, true};
+
+    /*!
+     * `writeSnapshot` stores a dictionary such that it can be memory mapped and read without decoding it.
+     * Opening a `GeneralSnapshot` only checks the header, keys are looked up in the index of the file.
+     * */
+    {
+        std::ofstream file("parameters.snapshot", std::ios::binary);
+        writeSnapshot(file, parameters);
+    }
+    {
+        const GeneralSnapshot<GenType> snapshot("parameters.snapshot");
+        std::cout << "Mapped " << snapshot.size() << " parameters" << std::endl;
+
+        //! Scalars are copied, strings and vectors of numbers are views into the mapped file
+        std::cout << "iterations: " << snapshot.at("iterations").get<int>() << std::endl;
+        std::cout << "name: " << snapshot.at("name").get<std::string>() << std::endl;
+        std::span<const double> weights = snapshot.at("weights").get<std::vector<double>>();
+        std::cout << "weights:";
+        for(double weight: weights){ std::cout << " " << weight; }
+        std::cout << std::endl;
+
+        //! Other types, e.g. std::vector<bool>, are decoded on access
+        std::cout << "mask:";
+        for(bool bit: snapshot.at("mask").get<std::vector<bool>>()){ std::cout << " " << bit; }
+        std::cout << std::endl;
+
+        //! Precomputed keys skip hashing, `find` returns an empty optional for missing keys
+        constexpr DictKey tolerance = "tolerance"_key;
+        std::cout << "tolerance: " << GenType(snapshot.at(tolerance)) << std::endl;
+        std::cout << "has seed: " << std::boolalpha << snapshot.find("seed").has_value() << std::endl;
+
+        //! Iteration visits the entries in the order they were written
+        for(auto [key,value]: snapshot){
+            if( value.holds<bool>() ){ std::cout << key << " is a bool: " << value.get<bool>() << std::endl; }
+        }
+
+        //! Reading another type than the held one throws
+        try{
+            snapshot.at("name").get<double>();
+        } catch(const std::bad_variant_access & e){
+            std::cout << "Caught: " << e.what() << std::endl;
+        }
+    }
+    std::remove("parameters.snapshot");
+
+    //! Snapshots can also be read from memory, which has to be aligned to 8 bytes
+    const std::vector<std::byte> data = toSnapshot(parameters);
+    const GeneralSnapshot<GenType> snapshot{std::span<const std::byte>(data)};
+    std::cout << "verbose from memory: " << snapshot.at("verbose").get<bool>() << std::endl;
+
+    //! An empty dictionary has an empty snapshot
+    const std::vector<std::byte> empty = toSnapshot(Dict());
+    std::cout << "empty snapshot size: " << GeneralSnapshot<GenType>{std::span<const std::byte>(empty)}.size() << std::endl;
+
+    //! A corrupted index without an empty slot ends the lookup of a missing key after probing every slot
+    std::vector<std::byte> corrupted = data;
+    SnapshotHeader header;
+    std::memcpy(&header, corrupted.data(), sizeof(header));
+    for(std::size_t slot = 0; slot < header.numberOfSlots; ++slot){
+        const SnapshotSlot full{0, 0};
+        std::memcpy(corrupted.data() + sizeof(header) + slot * sizeof(SnapshotSlot), &full, sizeof(full));
+    }
+    const GeneralSnapshot<GenType> corruptedSnapshot{std::span<const std::byte>(corrupted)};
+    std::cout << "corrupted index has seed: " << corruptedSnapshot.contains("seed") << std::endl;
+    try{
+        corruptedSnapshot.at("seed");
+    } catch(const std::out_of_range & e){
+        std::cout << "Caught: " << e.what() << std::endl;
+    }
+}
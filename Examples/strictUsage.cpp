@@ -0,0 +1,46 @@
+#include "../GeneralType.hpp"
+#include <string>
+
+/*!
+ * A `StrictGeneralType` behaves like a `GeneralType` but rejects operators and conversions
+ * which are not defined for any of the listed types at compile time.
+ * */
+typedef StrictGeneralType<
+    bool, int, double, std::string
+> GenType;
+
+typedef StrictGeneralType<
+    std::vector<double>, std::string
+> Container;
+
+int main(){
+    GenType INT = 2;
+    GenType DOUBLE = 3.14;
+    GenType STRING = std::string("pi");
+
+    //! Operators that are defined for some of the types are available as usual
+    std::cout << "INT * DOUBLE: " << INT * DOUBLE << std::endl;
+    std::cout << "STRING + STRING: " << STRING + STRING << std::endl;
+
+    //! Operators with a C++-Type on the left are checked against that type at compile time
+    std::cout << "2.0 * INT: " << 2.0 * INT << std::endl;
+    // This does not compile, as a std::string can not be divided by any of the types
+    // std::string("pi") / DOUBLE;
+
+    //! Operators that are not defined for any of the types do not compile
+    Container VECTOR = std::vector<double>{1,2,3};
+    // This does not compile, neither std::vector<double> nor std::string implement operator%
+    // VECTOR % VECTOR;
+    // This does not compile, neither std::vector<double> nor std::string can be cast to double
+    // double d = VECTOR;
+
+    /*! If the operator is defined for some but not the held types a `std::bad_variant_access`
+     * is thrown. In contrast to the `GeneralType` no error message is created, which keeps
+     * the error handling out of the compiled operators.
+     * */
+    try{
+        STRING - INT;
+    } catch(const std::bad_variant_access & e){
+        std::cout << "Caught: " << e.what() << std::endl;
+    }
+}
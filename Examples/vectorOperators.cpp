@@ -0,0 +1,59 @@
+#include "../GeneralType.hpp"
+#include <complex>
+#include <vector>
+
+// The same type list as in Examples/basicUsage.cpp
+typedef GeneralType<
+    bool,int,
+    float,double,
+    std::complex<float>,std::complex<double>,
+    std::vector<bool>, std::vector<int>,std::vector<float>,std::vector<double>,
+    std::vector<std::complex<float>>,std::vector<std::complex<double>>,
+    double*
+> GenType;
+
+//! Print a GenType holding a std::vector
+template<typename Type>
+void print(const char * name, GenType genT){
+    std::cout << name << ":";
+    for(const auto & element: Type(genT)){
+        std::cout << " " << element;
+    }
+    std::cout << std::endl;
+}
+
+int main(){
+    GenType VECTOR_D = std::vector<double>{1.0, 2.0, 3.0, 4.0};
+    GenType VECTOR_F = std::vector<float>{0.5f, 2.5f, 2.5f, 8.0f};
+    GenType VECTOR_C = std::vector<std::complex<double>>{{1,1}, {0,2}, {3,0}, {1,-1}};
+    GenType DOUBLE = 2.0;
+
+    /*!
+     * std::vector does not implement arithmetic operators, so the GenType applies them element wise
+     * to vectors of numeric elements. The loops are vectorized for the widest instruction set 
+     * (AVX-512, AVX2 or the baseline) the CPU supports.
+     * */
+    print<std::vector<double>>("VECTOR_D + VECTOR_D", VECTOR_D + VECTOR_D);
+    print<std::vector<double>>("VECTOR_D * VECTOR_F", VECTOR_D * VECTOR_F);
+
+    //! A scalar is applied to every element
+    print<std::vector<double>>("VECTOR_D / DOUBLE", VECTOR_D / DOUBLE);
+    print<std::vector<double>>("DOUBLE - VECTOR_D", DOUBLE - VECTOR_D);
+    print<std::vector<std::complex<double>>>("VECTOR_C * DOUBLE", VECTOR_C * DOUBLE);
+
+    //! Comparisons compare element wise and yield a std::vector<bool>
+    print<std::vector<bool>>("VECTOR_D < VECTOR_F", VECTOR_D < VECTOR_F);
+    print<std::vector<bool>>("VECTOR_D >= 3.0", VECTOR_D >= 3.0);
+
+    //! Compound assignments modify the elements in place
+    VECTOR_D += 1.0;
+    VECTOR_D *= VECTOR_F;
+    print<std::vector<double>>("(VECTOR_D + 1) * VECTOR_F", VECTOR_D);
+
+    //! Vectors of different size can not be combined
+    try{
+        VECTOR_D + GenType(std::vector<double>{1.0});
+    } catch(const std::invalid_argument & e){
+        std::cout << "Caught: " << e.what() << std::endl;
+    }
+}
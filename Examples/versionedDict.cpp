@@ -0,0 +1,60 @@
+#include "../VersionedGeneralDict.hpp"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+typedef GeneralType<
+    bool, int, double, std::string
+> GenType;
+
+typedef VersionedGeneralDict<
+    bool, int, double, std::string
+> Config;
+
+int main(){
+    /*!
+     * A `VersionedGeneralDict` holds immutable versions of a dictionary. Readers take a snapshot of the
+     * current version without a lock, writers publish a new version as a whole.
+     * */
+    Config config(Config::Dict{{"threads", 4}, {"timeout", 2.5}, {"mode", std::string("fast")}});
+    {
+        const Config::Snapshot snapshot = config.read();
+        std::cout << "version " << snapshot.version() << ": threads = " << snapshot->at("threads")
+                  << ", timeout = " << snapshot->at("timeout") << std::endl;
+
+        //! A snapshot does not change, even if a new version is published meanwhile
+        config.update([](Config::Dict & dict){ dict["threads"] = 8; });
+        std::cout << "old snapshot: threads = " << snapshot->at("threads") << std::endl;
+    }
+    std::cout << "version " << config.version() << ": threads = " << config.get("threads").value() << std::endl;
+
+    /*!
+     * Readers see every version completely or not at all. The writer below reloads the configuration
+     * many times, each version keeps `low + high == 100`. The readers never wait for the writer.
+     * */
+    config.update([](Config::Dict & dict){ dict["low"] = 0; dict["high"] = 100; });
+    std::atomic<bool> done = false;
+    std::atomic<std::size_t> reads = 0, inconsistent = 0;
+    std::vector<std::thread> readers;
+    for(int t = 0; t < 4; ++t){
+        readers.emplace_back([&]{
+            while( !done ){
+                const Config::Snapshot snapshot = config.read();
+                if( int(snapshot->at("low")) + int(snapshot->at("high")) != 100 ){ ++inconsistent; }
+                ++reads;
+            }
+        });
+    }
+    std::thread writer([&]{
+        for(int i = 1; i <= 2000; ++i){
+            config.update([i](Config::Dict & dict){ dict["low"] = i % 100; dict["high"] = 100 - i % 100; });
+        }
+        done = true;
+    });
+    writer.join();
+    for(std::thread & reader: readers){ reader.join(); }
+    std::cout << "reads: " << (reads > 0 ? "done" : "none") << ", inconsistent: " << inconsistent << std::endl;
+
+    //! Replaced versions are freed as soon as no snapshot references them
+    std::cout << "version " << config.version() << ", replaced versions still referenced: " << config.reclaim() << std::endl;
+}
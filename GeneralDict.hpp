@@ -0,0 +1,568 @@
+#pragma once
+
+#include "GeneralType.hpp"
+
+#include<cstdint>
+#include<initializer_list>
+#include<iterator>
+#include<limits>
+#include<stdexcept>
+#include<string>
+#include<string_view>
+#include<utility>
+#include<vector>
+
+namespace {
+
+//! Read `Bytes` characters of `key` starting at `position` as a little endian integer.
+//! Compilers merge the loop into a single load.
+template<std::size_t Bytes>
+constexpr std::uint64_t readBlock(std::string_view key, std::size_t position){
+    std::uint64_t block = 0;
+    for(std::size_t i = 0; i < Bytes; ++i){
+        block |= std::uint64_t(static_cast<unsigned char>(key[position + i])) << (8 * i);
+    }
+    return block;
+}
+
+//! Hash of the keys of a `GeneralDict`, can be evaluated at compile time
+constexpr std::uint64_t hashKey(std::string_view key){
+    constexpr std::uint64_t multiplier = 0x9e3779b97f4a7c15ull;
+    std::uint64_t hash = key.size() * multiplier;
+    std::size_t position = 0;
+    for(; position + 8 <= key.size(); position += 8){
+        hash = (hash ^ readBlock<8>(key, position)) * multiplier;
+        hash ^= hash >> 29;
+    }
+    // the remaining 0 to 7 characters are read with overlapping loads of fixed size
+    const std::size_t rest = key.size() - position;
+    std::uint64_t block = 0;
+    if( rest >= 4 ){
+        block = readBlock<4>(key, position) | (readBlock<4>(key, position + rest - 4) << 32);
+    } else if( rest > 0 ){
+        block = readBlock<1>(key, position) | (readBlock<1>(key, position + rest / 2) << 8)
+            | (readBlock<1>(key, position + rest - 1) << 16);
+    }
+    hash = (hash ^ block) * multiplier;
+    // final mix of murmur3, such that the lower bits (the position) and the upper bits
+    // (the fingerprint) depend on all characters
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdull;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ull;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+} // namespace
+
+/*!
+ * A key of a `GeneralDict` together with its hash. Creating the key from a string literal at
+ * compile time, e.g. `constexpr DictKey key = "key1"_key;`, removes the hashing from the lookup.
+ * The key references the characters it was created from.
+ */
+class DictKey {
+    public:
+    //! Create the key `name` and compute its hash
+    explicit constexpr DictKey(std::string_view name) :
+        name_(name), hash_(hashKey(name))
+    {}
+
+    //! The name of the key
+    constexpr std::string_view name() const { return name_; }
+
+    //! The hash of the key
+    constexpr std::uint64_t hash() const { return hash_; }
+
+    protected:
+    std::string_view name_;
+    std::uint64_t hash_;
+};
+
+//! Create a `DictKey` from a string literal at compile time
+consteval DictKey operator""_key(const char * name, std::size_t size){
+    return DictKey(std::string_view(name, size));
+}
+
+/*!
+ * A dictionary mapping strings to `GeneralType`s, similar to a Python dict.
+ * The entries (key, value and the hash of the key) are stored contiguously in insertion order,
+ * an open addressing hash table with linear probing maps the keys to their entries. Every slot of
+ * the table stores a fingerprint of the hash next to the index of the entry, such that a lookup
+ * usually compares a single key. Keys are `std::string`s, which store short keys (up to 15
+ * characters with libstdc++) inline without allocation, and are looked up with `std::string_view`s
+ * without creating a `std::string`.
+ *
+ * Keys can be looked up with a precomputed hash (`DictKey`) or interned into a `Handle`, which is
+ * the index of the entry and turns the lookup into an array access.
+ *
+ * Iteration visits the entries in insertion order as long as no entry is erased. Erasing moves the
+ * last entry into the gap unless `StableOrder` is set, which keeps the insertion order at the cost
+ * of an erase linear in the size.
+ */
+template<typename ErrorPolicy, bool StableOrder, typename ... Types_>
+class BasicGeneralDict{
+    public:
+    //! The type of the keys
+    using key_type = std::string;
+
+    //! The type of the values
+    using mapped_type = BasicGeneralType<ErrorPolicy, Types_...>;
+
+    protected:
+    //! A single entry of the dictionary
+    struct Entry {
+        std::string key;
+        mapped_type value;
+        std::size_t hash;
+    };
+
+    //! A slot of the hash table
+    struct Slot {
+        //! Upper bits of the hash of the key
+        std::uint32_t fingerprint;
+        //! Index of the entry, `emptySlot` if the slot is empty
+        std::uint32_t entry;
+    };
+
+    //! Marks an empty slot
+    static constexpr std::uint32_t emptySlot = std::numeric_limits<std::uint32_t>::max();
+
+    //! Marks that a key was not found
+    static constexpr std::size_t notFound = std::numeric_limits<std::size_t>::max();
+
+    //! Minimal number of slots of a non-empty table
+    static constexpr std::size_t minimalSlots = 8;
+
+    //! Up to this number of entries keys are searched linearly instead of hashed
+    static constexpr std::size_t linearSearchSize = 8;
+
+    public:
+    //! Iterator over the entries, dereferences to a pair of references to the key and the value
+    template<bool Const>
+    class Iterator {
+        using EntryPointer = std::conditional_t<Const, const Entry *, Entry *>;
+        using Value = std::conditional_t<Const, const mapped_type, mapped_type>;
+
+        public:
+        using value_type = std::pair<const std::string &, Value &>;
+        using reference = value_type;
+        using difference_type = std::ptrdiff_t;
+        using iterator_category = std::forward_iterator_tag;
+
+        //! Gives `operator->` access to the members of the pair of references
+        struct Pointer {
+            value_type pair;
+            const value_type * operator->() const { return &pair; }
+        };
+
+        Iterator() = default;
+
+        //! Convert a mutable iterator into a constant one
+        template<bool OtherConst>
+            requires( Const && !OtherConst )
+        Iterator(const Iterator<OtherConst> & other) :
+            entry_(other.entry_)
+        {}
+
+        reference operator*() const { return {entry_->key, entry_->value}; }
+        Pointer operator->() const { return Pointer{**this}; }
+
+        Iterator & operator++(){ ++entry_; return *this; }
+        Iterator operator++(int){ Iterator old = *this; ++entry_; return old; }
+
+        friend bool operator==(const Iterator & lhs, const Iterator & rhs){ return lhs.entry_ == rhs.entry_; }
+
+        private:
+        friend class BasicGeneralDict;
+        template<bool> friend class Iterator;
+
+        explicit Iterator(EntryPointer entry) :
+            entry_(entry)
+        {}
+
+        EntryPointer entry_ = nullptr;
+    };
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    //! An interned key, created by `intern`. Handles stay valid until an entry is erased or the dictionary is cleared.
+    class Handle {
+        public:
+        Handle() = default;
+
+        private:
+        friend class BasicGeneralDict;
+
+        explicit Handle(std::size_t index) :
+            index_(std::uint32_t(index))
+        {}
+
+        std::uint32_t index_ = 0;
+    };
+
+    //! Default-construct an empty dictionary
+    BasicGeneralDict() = default;
+
+    //! Construct a dictionary from a list of key value pairs, later duplicates overwrite earlier ones
+    BasicGeneralDict(std::initializer_list<std::pair<std::string_view, mapped_type>> values){
+        reserve(values.size());
+        for(const auto & [key,value]: values){
+            insert_or_assign(key, value);
+        }
+    }
+
+    //! Number of entries
+    std::size_t size() const { return entries_.size(); }
+
+    //! Check if there are no entries
+    bool empty() const { return entries_.empty(); }
+
+    //! Remove all entries
+    void clear(){
+        entries_.clear();
+        slots_.clear();
+    }
+
+    //! Prepare the dictionary for `count` entries without rehashing
+    void reserve(std::size_t count){
+        entries_.reserve(count);
+        if( !fits(count, slots_.size()) ){
+            rehash(slotsFor(count));
+        }
+    }
+
+    iterator begin(){ return iterator(entries_.data()); }
+    iterator end(){ return iterator(entries_.data() + entries_.size()); }
+    const_iterator begin() const { return const_iterator(entries_.data()); }
+    const_iterator end() const { return const_iterator(entries_.data() + entries_.size()); }
+
+    //! Find the entry with the key `key`, `end()` if there is none
+    iterator find(std::string_view key){
+        const std::size_t index = findEntry(key);
+        return index == notFound ? end() : iterator(entries_.data() + index);
+    }
+
+    //! Find the entry with the key `key`, `end()` if there is none
+    const_iterator find(std::string_view key) const {
+        const std::size_t index = findEntry(key);
+        return index == notFound ? end() : const_iterator(entries_.data() + index);
+    }
+
+    //! Find the entry with the precomputed key `key`, `end()` if there is none
+    iterator find(DictKey key){
+        const std::size_t index = findEntry(key);
+        return index == notFound ? end() : iterator(entries_.data() + index);
+    }
+
+    //! Find the entry with the precomputed key `key`, `end()` if there is none
+    const_iterator find(DictKey key) const {
+        const std::size_t index = findEntry(key);
+        return index == notFound ? end() : const_iterator(entries_.data() + index);
+    }
+
+    //! Check if there is an entry with the key `key`
+    bool contains(std::string_view key) const {
+        return findEntry(key) != notFound;
+    }
+
+    //! Check if there is an entry with the precomputed key `key`
+    bool contains(DictKey key) const {
+        return findEntry(key) != notFound;
+    }
+
+    //! Number of entries with the key `key`, i.e. 0 or 1
+    std::size_t count(std::string_view key) const {
+        return contains(key) ? 1 : 0;
+    }
+
+    //! Access the value of `key`, throws a `std::out_of_range` if there is none
+    mapped_type & at(std::string_view key){
+        return entries_[checkedEntry(findEntry(key), key)].value;
+    }
+
+    //! Access the value of `key`, throws a `std::out_of_range` if there is none
+    const mapped_type & at(std::string_view key) const {
+        return entries_[checkedEntry(findEntry(key), key)].value;
+    }
+
+    //! Access the value of the precomputed key `key`, throws a `std::out_of_range` if there is none
+    mapped_type & at(DictKey key){
+        return entries_[checkedEntry(findEntry(key), key.name())].value;
+    }
+
+    //! Access the value of the precomputed key `key`, throws a `std::out_of_range` if there is none
+    const mapped_type & at(DictKey key) const {
+        return entries_[checkedEntry(findEntry(key), key.name())].value;
+    }
+
+    //! Access the value of `key`, a default constructed value is inserted if there is none
+    mapped_type & operator[](std::string_view key){
+        return try_emplace(key).first->second;
+    }
+
+    //! Access the value of the precomputed key `key`, a default constructed value is inserted if there is none
+    mapped_type & operator[](DictKey key){
+        std::size_t index = findEntry(key);
+        if( index == notFound ){
+            index = insertEntry(key.name(), key.hash());
+        }
+        return entries_[index].value;
+    }
+
+    //! Access the value of an interned key
+    mapped_type & operator[](Handle handle){
+        return entries_[handle.index_].value;
+    }
+
+    //! Access the value of an interned key
+    const mapped_type & operator[](Handle handle) const {
+        return entries_[handle.index_].value;
+    }
+
+    //! Intern `key`, a default constructed value is inserted if there is no entry with the key
+    Handle intern(std::string_view key){
+        return Handle(try_emplace(key).first.entry_ - entries_.data());
+    }
+
+    //! Intern the precomputed key `key`, a default constructed value is inserted if there is no entry with the key
+    Handle intern(DictKey key){
+        std::size_t index = findEntry(key);
+        if( index == notFound ){
+            index = insertEntry(key.name(), key.hash());
+        }
+        return Handle(index);
+    }
+
+    //! The key of an interned key
+    std::string_view key(Handle handle) const {
+        return entries_[handle.index_].key;
+    }
+
+    //! Insert a value constructed from `args` if there is no entry with the key `key`.
+    //! Returns the entry of `key` and whether the value was inserted.
+    template<typename ... Args>
+    std::pair<iterator,bool> try_emplace(std::string_view key, Args && ... args){
+        // the hash is needed for the insertion anyway
+        const DictKey hashedKey(key);
+        const std::size_t index = findEntry(hashedKey);
+        if( index != notFound ){
+            return {iterator(entries_.data() + index), false};
+        }
+        const std::size_t inserted = insertEntry(key, hashedKey.hash(), std::forward<Args>(args)...);
+        return {iterator(entries_.data() + inserted), true};
+    }
+
+    //! Assign `value` to `key`, inserting it if there is no entry with the key.
+    //! Returns the entry of `key` and whether the value was inserted.
+    template<typename Value>
+    std::pair<iterator,bool> insert_or_assign(std::string_view key, Value && value){
+        auto result = try_emplace(key, std::forward<Value>(value));
+        if( !result.second ){
+            result.first->second = std::forward<Value>(value);
+        }
+        return result;
+    }
+
+    //! Remove the entry with the key `key`, returns the number of removed entries
+    std::size_t erase(std::string_view key){
+        const std::size_t hash = hashOf(key);
+        const std::size_t slot = findSlot(key, hash);
+        if( slot == notFound ){ return 0; }
+
+        const std::size_t index = slots_[slot].entry;
+        eraseSlot(slot);
+        if constexpr( StableOrder ){
+            entries_.erase(entries_.begin() + index);
+            for(Slot & other: slots_){
+                if( other.entry != emptySlot && other.entry > index ){ --other.entry; }
+            }
+        } else {
+            const std::size_t last = entries_.size() - 1;
+            if( index != last ){
+                slots_[findSlotOfEntry(last)].entry = std::uint32_t(index);
+                entries_[index] = std::move(entries_[last]);
+            }
+            entries_.pop_back();
+        }
+        return 1;
+    }
+
+    protected:
+    //! Hash of a key
+    static std::size_t hashOf(std::string_view key){
+        return hashKey(key);
+    }
+
+    //! Fingerprint of a hash stored in the slots
+    static std::uint32_t fingerprintOf(std::size_t hash){
+        return std::uint32_t(std::uint64_t(hash) >> 32);
+    }
+
+    //! Check if `count` entries fit into `numberOfSlots` slots, the table is filled up to 3/4
+    static bool fits(std::size_t count, std::size_t numberOfSlots){
+        return count * 4 <= numberOfSlots * 3;
+    }
+
+    //! Smallest number of slots `count` entries fit into
+    static std::size_t slotsFor(std::size_t count){
+        std::size_t numberOfSlots = minimalSlots;
+        while( !fits(count, numberOfSlots) ){ numberOfSlots *= 2; }
+        return numberOfSlots;
+    }
+
+    //! Position of the slot of `key`, `notFound` if the key is not contained
+    std::size_t findSlot(std::string_view key, std::size_t hash) const {
+        if( slots_.empty() ){ return notFound; }
+        const std::size_t mask = slots_.size() - 1;
+        const std::uint32_t fingerprint = fingerprintOf(hash);
+        for(std::size_t position = hash & mask; ; position = (position + 1) & mask){
+            const Slot & slot = slots_[position];
+            if( slot.entry == emptySlot ){
+                return notFound;
+            }
+            if( slot.fingerprint == fingerprint && std::string_view(entries_[slot.entry].key) == key ){
+                return position;
+            }
+        }
+    }
+
+    //! Index of the entry of `key`, `notFound` if the key is not contained.
+    //! Small dictionaries compare the keys directly, which is faster than hashing the key.
+    std::size_t findEntry(std::string_view key) const {
+        if( entries_.size() <= linearSearchSize ){
+            for(std::size_t index = 0; index < entries_.size(); ++index){
+                if( std::string_view(entries_[index].key) == key ){ return index; }
+            }
+            return notFound;
+        }
+        const std::size_t slot = findSlot(key, hashOf(key));
+        return slot == notFound ? notFound : slots_[slot].entry;
+    }
+
+    //! Index of the entry of the precomputed key `key`, `notFound` if the key is not contained
+    std::size_t findEntry(DictKey key) const {
+        if( entries_.size() <= linearSearchSize ){
+            return findEntry(key.name());
+        }
+        const std::size_t slot = findSlot(key.name(), key.hash());
+        return slot == notFound ? notFound : slots_[slot].entry;
+    }
+
+    //! Check the `index` of the entry of `key`, throws a `std::out_of_range` if the key is not contained
+    static std::size_t checkedEntry(std::size_t index, std::string_view key){
+        if( index == notFound ){
+            throw std::out_of_range("GeneralDict does not contain the key \"" + std::string(key) + "\"");
+        }
+        return index;
+    }
+
+    //! Append an entry with the key `key`, that is not contained, and a value constructed from `args`.
+    //! Returns the index of the new entry.
+    template<typename ... Args>
+    std::size_t insertEntry(std::string_view key, std::size_t hash, Args && ... args){
+        if( !fits(entries_.size() + 1, slots_.size()) ){
+            rehash(slots_.empty() ? minimalSlots : 2 * slots_.size());
+        }
+        insertSlot(hash, entries_.size());
+        entries_.push_back(Entry{std::string(key), mapped_type(std::forward<Args>(args)...), hash});
+        return entries_.size() - 1;
+    }
+
+    //! Position of the slot pointing to the entry at `index`
+    std::size_t findSlotOfEntry(std::size_t index) const {
+        const std::size_t mask = slots_.size() - 1;
+        std::size_t position = entries_[index].hash & mask;
+        while( slots_[position].entry != index ){
+            position = (position + 1) & mask;
+        }
+        return position;
+    }
+
+    //! Insert a slot for the entry at `index` with hash `hash`, the table must have a free slot
+    void insertSlot(std::size_t hash, std::size_t index){
+        const std::size_t mask = slots_.size() - 1;
+        std::size_t position = hash & mask;
+        while( slots_[position].entry != emptySlot ){
+            position = (position + 1) & mask;
+        }
+        slots_[position] = Slot{fingerprintOf(hash), std::uint32_t(index)};
+    }
+
+    //! Empty the slot at `position` and move the following slots of the probe sequence back,
+    //! such that no lookup stops early at the gap
+    void eraseSlot(std::size_t position){
+        const std::size_t mask = slots_.size() - 1;
+        std::size_t gap = position;
+        for(std::size_t next = (gap + 1) & mask; slots_[next].entry != emptySlot; next = (next + 1) & mask){
+            const std::size_t home = entries_[slots_[next].entry].hash & mask;
+            // move the slot into the gap if the gap lies between its home position and its position
+            if( ((next - home) & mask) >= ((next - gap) & mask) ){
+                slots_[gap] = slots_[next];
+                gap = next;
+            }
+        }
+        slots_[gap].entry = emptySlot;
+    }
+
+    //! Replace the table by `numberOfSlots` empty slots
+    void resetSlots(std::size_t numberOfSlots){
+        if( numberOfSlots > std::size_t(emptySlot) ){
+            throw std::length_error("GeneralDict exceeds the maximal number of entries");
+        }
+        slots_.assign(numberOfSlots, Slot{0, emptySlot});
+    }
+
+    //! Rebuild the table with `numberOfSlots` slots from the stored hashes
+    void rehash(std::size_t numberOfSlots){
+        resetSlots(numberOfSlots);
+        for(std::size_t index = 0; index < entries_.size(); ++index){
+            insertSlot(entries_[index].hash, index);
+        }
+    }
+
+    //! Build the table for entries that were appended to `entries_` directly. Returns false and
+    //! removes all entries if two entries have the same key.
+    bool rebuildUnique(){
+        slots_.clear();
+        if( entries_.empty() ){ return true; }
+        resetSlots(slotsFor(entries_.size()));
+        const std::size_t mask = slots_.size() - 1;
+        for(std::size_t index = 0; index < entries_.size(); ++index){
+            const Entry & entry = entries_[index];
+            const std::uint32_t fingerprint = fingerprintOf(entry.hash);
+            std::size_t position = entry.hash & mask;
+            for(; slots_[position].entry != emptySlot; position = (position + 1) & mask){
+                const Slot & slot = slots_[position];
+                if( slot.fingerprint == fingerprint && entries_[slot.entry].key == entry.key ){
+                    clear();
+                    return false;
+                }
+            }
+            slots_[position] = Slot{fingerprint, std::uint32_t(index)};
+        }
+        return true;
+    }
+
+    // The binary format appends the entries it reads directly
+    template<typename> friend struct BinaryFormat;
+
+    //! The entries in insertion order
+    std::vector<Entry> entries_;
+
+    //! The hash table, its size is zero or a power of two
+    std::vector<Slot> slots_;
+}; // BasicGeneralDict<ErrorPolicy,StableOrder,Types_...>
+
+//! A dictionary mapping strings to `GeneralType<Types_...>`
+template<typename ... Types_>
+using GeneralDict = BasicGeneralDict<RuntimeErrorPolicy, false, Types_...>;
+
+//! A dictionary mapping strings to `GeneralType<Types_...>` that keeps the insertion order when erasing
+template<typename ... Types_>
+using StableGeneralDict = BasicGeneralDict<RuntimeErrorPolicy, true, Types_...>;
+
+//! A dictionary mapping strings to `StrictGeneralType<Types_...>`
+template<typename ... Types_>
+using StrictGeneralDict = BasicGeneralDict<StrictErrorPolicy, false, Types_...>;
@@ -0,0 +1,373 @@
+#pragma once
+
+#include "GeneralType.hpp"
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
+// Expression templates for chains of the arithmetic operators `+ - * /` on GeneralTypes. Starting a
+// chain with `lazy(genT)` makes the operators return lightweight expression nodes instead of
+// GeneralTypes. The expression is evaluated once it is converted to a GeneralType:
+//  - If all operands hold the same numeric type or a std::vector of it, the held types are checked
+//    once and the expression is computed without intermediate GeneralTypes. Vectors are computed in
+//    blocks that stay in the cache, passing over the operands only once.
+//  - Otherwise the operators of the GeneralType are applied one after the other.
+// Expressions reference their GeneralType operands, evaluate them before the operands are destroyed,
+// usually within the same statement.
+
+namespace {
+
+//! A GeneralType operand of an expression
+template<typename GenType>
+struct LeafNode {
+    const GenType & value;
+};
+
+//! A C++-Type operand of an expression
+template<typename Type>
+struct ScalarNode {
+    Type value;
+};
+
+//! The application of `Operation` to two nodes, `ElementOperation` is the same operator on elements
+template<typename Operation, typename ElementOperation, typename Lhs, typename Rhs>
+struct BinaryNode {
+    Lhs lhs;
+    Rhs rhs;
+};
+
+//! Index of `Type` in the alternatives of the `std::variant` `Variant`, the number of alternatives if it is not contained
+template<typename Type, typename Variant>
+constexpr std::size_t indexInVariant = 0;
+
+template<typename Type, typename ... Alternatives>
+constexpr std::size_t indexInVariant<Type,std::variant<Alternatives...>> = indexOfType<Type,Alternatives...>();
+
+//! Checks if `Type` is a `GeneralExpression`
+template<typename Type>
+constexpr bool isGeneralExpression = false;
+
+template<typename GenType, typename Node>
+constexpr bool isGeneralExpression<GeneralExpression<GenType,Node>> = true;
+
+//! Checks if the elements of type `Type` can be computed without intermediate GeneralTypes,
+//! i.e. the arithmetic operators on two elements yield an element again
+template<typename Type>
+constexpr bool isFusableElement = isNumericElement<Type> && requires(Type t) {
+    { t + t } -> std::same_as<Type>;
+    { t - t } -> std::same_as<Type>;
+    { t * t } -> std::same_as<Type>;
+    { t / t } -> std::same_as<Type>;
+};
+
+//! The element type an alternative of a GeneralType contributes to a fused expression, `void` if none
+template<typename Alternative>
+struct FusedElement { using type = void; };
+
+template<typename Alternative>
+    requires isFusableElement<Alternative>
+struct FusedElement<Alternative> { using type = Alternative; };
+
+template<typename Element>
+    requires isFusableElement<Element>
+struct FusedElement<std::vector<Element>> { using type = Element; };
+
+} // namespace
+
+/*!
+ * A lazily evaluated expression of GeneralTypes of type `GenType`, `Node` is the root of the
+ * expression tree. Expressions are created by `lazy` and combined with GeneralTypes, other
+ * expressions and C++-Types which are one of the types of the GeneralType.
+ * */
+template<typename GenType, typename Node>
+class GeneralExpression {
+    protected:
+    //! The type of the variant held by `GenType`
+    using Variant = typename GenType::Variant;
+
+    //! Checks if `Type` can be an operand: an expression or a GeneralType of type `GenType` or one of its types
+    template<typename Type>
+    static constexpr bool isOperand = std::is_same_v<Type,GenType> || isGeneralExpression<Type>
+        || indexInVariant<Type,Variant> < GenType::numberOfAlternatives;
+
+    public:
+    //! Construct an expression from its root node
+    explicit GeneralExpression(Node node) :
+        node_(std::move(node))
+    {}
+
+    //! Evaluate the expression
+    GenType evaluate() const {
+        static constexpr auto table = makeEvaluationTable(std::make_index_sequence<GenType::numberOfAlternatives>{});
+        const std::size_t index = leftmostIndex(node_);
+        if( index >= GenType::numberOfAlternatives ) [[unlikely]] {
+            throw std::bad_variant_access();
+        }
+        return table[index](node_);
+    }
+
+    //! Evaluate the expression, e.g. when it is assigned to a GeneralType
+    operator GenType() const {
+        return evaluate();
+    }
+
+    //! The root node of the expression tree
+    const Node & node() const {
+        return node_;
+    }
+
+    // =========================================================================================
+    // Operators
+    // =========================================================================================
+
+    //! Addition of an expression and an operand
+    template<typename Rhs>
+        requires( isOperand<Rhs> && requires(const GenType & genT){ genT + genT; } )
+    friend auto operator+(const GeneralExpression & lhs, const Rhs & rhs){
+        return combine<AdditionOperator,ElementwiseAddition>(lhs, rhs);
+    }
+
+    //! Addition of an operand and an expression
+    template<typename Lhs>
+        requires( isOperand<Lhs> && !isGeneralExpression<Lhs> && requires(const GenType & genT){ genT + genT; } )
+    friend auto operator+(const Lhs & lhs, const GeneralExpression & rhs){
+        return combine<AdditionOperator,ElementwiseAddition>(lhs, rhs);
+    }
+
+    //! Subtraction of an expression and an operand
+    template<typename Rhs>
+        requires( isOperand<Rhs> && requires(const GenType & genT){ genT - genT; } )
+    friend auto operator-(const GeneralExpression & lhs, const Rhs & rhs){
+        return combine<SubtractionOperator,ElementwiseSubtraction>(lhs, rhs);
+    }
+
+    //! Subtraction of an operand and an expression
+    template<typename Lhs>
+        requires( isOperand<Lhs> && !isGeneralExpression<Lhs> && requires(const GenType & genT){ genT - genT; } )
+    friend auto operator-(const Lhs & lhs, const GeneralExpression & rhs){
+        return combine<SubtractionOperator,ElementwiseSubtraction>(lhs, rhs);
+    }
+
+    //! Multiplication of an expression and an operand
+    template<typename Rhs>
+        requires( isOperand<Rhs> && requires(const GenType & genT){ genT * genT; } )
+    friend auto operator*(const GeneralExpression & lhs, const Rhs & rhs){
+        return combine<MultiplicationOperator,ElementwiseMultiplication>(lhs, rhs);
+    }
+
+    //! Multiplication of an operand and an expression
+    template<typename Lhs>
+        requires( isOperand<Lhs> && !isGeneralExpression<Lhs> && requires(const GenType & genT){ genT * genT; } )
+    friend auto operator*(const Lhs & lhs, const GeneralExpression & rhs){
+        return combine<MultiplicationOperator,ElementwiseMultiplication>(lhs, rhs);
+    }
+
+    //! Division of an expression and an operand
+    template<typename Rhs>
+        requires( isOperand<Rhs> && requires(const GenType & genT){ genT / genT; } )
+    friend auto operator/(const GeneralExpression & lhs, const Rhs & rhs){
+        return combine<DivisionOperator,ElementwiseDivision>(lhs, rhs);
+    }
+
+    //! Division of an operand and an expression
+    template<typename Lhs>
+        requires( isOperand<Lhs> && !isGeneralExpression<Lhs> && requires(const GenType & genT){ genT / genT; } )
+    friend auto operator/(const Lhs & lhs, const GeneralExpression & rhs){
+        return combine<DivisionOperator,ElementwiseDivision>(lhs, rhs);
+    }
+
+    protected:
+    // Expressions of other node types access the nodes and evaluation functions
+    template<typename, typename> friend class GeneralExpression;
+
+    //! The expression node of an operand
+    template<typename Type>
+    static auto makeNode(const Type & operand){
+        if constexpr( isGeneralExpression<Type> ){
+            return operand.node();
+        } else if constexpr( std::is_same_v<Type,GenType> ){
+            return LeafNode<GenType>{operand};
+        } else {
+            return ScalarNode<Type>{operand};
+        }
+    }
+
+    //! Combine two operands to an expression applying `Operation`
+    template<typename Operation, typename ElementOperation, typename Lhs, typename Rhs>
+    static auto combine(const Lhs & lhs, const Rhs & rhs){
+        using LhsNode = decltype(makeNode(lhs));
+        using RhsNode = decltype(makeNode(rhs));
+        using Root = BinaryNode<Operation,ElementOperation,LhsNode,RhsNode>;
+        return GeneralExpression<GenType,Root>(Root{makeNode(lhs), makeNode(rhs)});
+    }
+
+    // =========================================================================================
+    // Eager evaluation with the operators of the GeneralType
+    // =========================================================================================
+
+    static const GenType & evaluateEager(const LeafNode<GenType> & node){
+        return node.value;
+    }
+
+    template<typename Type>
+    static GenType evaluateEager(const ScalarNode<Type> & node){
+        return GenType(node.value);
+    }
+
+    template<typename Operation, typename ElementOperation, typename Lhs, typename Rhs>
+    static GenType evaluateEager(const BinaryNode<Operation,ElementOperation,Lhs,Rhs> & node){
+        return Operation::apply(evaluateEager(node.lhs), evaluateEager(node.rhs));
+    }
+
+    // =========================================================================================
+    // Fused evaluation, all operands hold `Element` or `std::vector<Element>`
+    // =========================================================================================
+
+    //! Number of elements of vectors computed at once
+    static constexpr std::size_t fusedBlockSize = 256;
+
+    //! Marks that no operand holds a vector
+    static constexpr std::size_t noVector = std::numeric_limits<std::size_t>::max();
+
+    //! Generate the table of evaluation functions, one per alternative held by the leftmost operand
+    template<std::size_t ... Indices>
+    static constexpr auto makeEvaluationTable(std::index_sequence<Indices...>){
+        using Entry = GenType (*)(const Node &);
+        return std::array<Entry, sizeof...(Indices)>{
+            &evaluateAs<std::variant_alternative_t<Indices,Variant>>...
+        };
+    }
+
+    //! Index of the alternative held by the leftmost operand of the expression
+    static std::size_t leftmostIndex(const LeafNode<GenType> & node){
+        return node.value.obj_.index();
+    }
+
+    template<typename Type>
+    static constexpr std::size_t leftmostIndex(const ScalarNode<Type> &){
+        return indexInVariant<Type,Variant>;
+    }
+
+    template<typename Operation, typename ElementOperation, typename Lhs, typename Rhs>
+    static std::size_t leftmostIndex(const BinaryNode<Operation,ElementOperation,Lhs,Rhs> & node){
+        return leftmostIndex(node.lhs);
+    }
+
+    //! Evaluate the expression fused if all operands hold the element type of `Alternative`, eagerly otherwise
+    template<typename Alternative>
+    static GenType evaluateAs(const Node & node){
+        using Element = typename FusedElement<Alternative>::type;
+        if constexpr( !std::is_void_v<Element> ){
+            std::size_t size = noVector;
+            if( holdsElement<Element>(node, size) ){
+                if constexpr( indexInVariant<std::vector<Element>,Variant> < GenType::numberOfAlternatives ){
+                    if( size != noVector ){
+                        std::vector<Element> values(size);
+                        for(std::size_t begin = 0; begin < size; begin += fusedBlockSize){
+                            evaluateBlock<Element>(node, begin, std::min(fusedBlockSize, size - begin), values.data() + begin);
+                        }
+                        return GenType(std::move(values));
+                    }
+                }
+                return GenType(evaluateElement<Element>(node));
+            }
+        }
+        return GenType(evaluateEager(node));
+    }
+
+    //! Checks if the operand holds `Element` or a `std::vector<Element>` of `size` elements,
+    //! the first vector sets `size`
+    template<typename Element>
+    static bool holdsElement(const LeafNode<GenType> & node, std::size_t & size){
+        constexpr std::size_t vectorIndex = indexInVariant<std::vector<Element>,Variant>;
+        constexpr std::size_t elementIndex = indexInVariant<Element,Variant>;
+        if constexpr( vectorIndex < GenType::numberOfAlternatives ){
+            if( const auto * vector = std::get_if<vectorIndex>(&node.value.obj_) ){
+                if( size == noVector ){ size = vector->size(); }
+                return vector->size() == size;
+            }
+        }
+        if constexpr( elementIndex < GenType::numberOfAlternatives ){
+            return node.value.obj_.index() == elementIndex;
+        }
+        return false;
+    }
+
+    template<typename Element, typename Type>
+    static bool holdsElement(const ScalarNode<Type> &, std::size_t &){
+        return std::is_same_v<Type,Element>;
+    }
+
+    template<typename Element, typename Operation, typename ElementOperation, typename Lhs, typename Rhs>
+    static bool holdsElement(const BinaryNode<Operation,ElementOperation,Lhs,Rhs> & node, std::size_t & size){
+        return holdsElement<Element>(node.lhs, size) && holdsElement<Element>(node.rhs, size);
+    }
+
+    //! Evaluate an expression of operands that all hold `Element`
+    template<typename Element>
+    static Element evaluateElement(const LeafNode<GenType> & node){
+        return *std::get_if<indexInVariant<Element,Variant>>(&node.value.obj_);
+    }
+
+    template<typename Element, typename Type>
+    static Element evaluateElement(const ScalarNode<Type> & node){
+        return Element(node.value);
+    }
+
+    template<typename Element, typename Operation, typename ElementOperation, typename Lhs, typename Rhs>
+    static Element evaluateElement(const BinaryNode<Operation,ElementOperation,Lhs,Rhs> & node){
+        return Operation::apply(evaluateElement<Element>(node.lhs), evaluateElement<Element>(node.rhs));
+    }
+
+    //! Call `function` with the operand of the element wise operators for the elements `begin` to `begin+count`
+    template<typename Element, typename Function>
+    static void withOperand(const LeafNode<GenType> & node, std::size_t begin, std::size_t, Function && function){
+        constexpr std::size_t vectorIndex = indexInVariant<std::vector<Element>,Variant>;
+        constexpr std::size_t elementIndex = indexInVariant<Element,Variant>;
+        if constexpr( vectorIndex < GenType::numberOfAlternatives ){
+            if( const auto * vector = std::get_if<vectorIndex>(&node.value.obj_) ){
+                return function(ArrayOperand<Element>{vector->data() + begin});
+            }
+        }
+        if constexpr( elementIndex < GenType::numberOfAlternatives ){
+            function(ScalarOperand<Element>{*std::get_if<elementIndex>(&node.value.obj_)});
+        }
+    }
+
+    template<typename Element, typename Type, typename Function>
+    static void withOperand(const ScalarNode<Type> & node, std::size_t, std::size_t, Function && function){
+        function(ScalarOperand<Element>{Element(node.value)});
+    }
+
+    template<typename Element, typename Operation, typename ElementOperation, typename Lhs, typename Rhs, typename Function>
+    static void withOperand(
+        const BinaryNode<Operation,ElementOperation,Lhs,Rhs> & node, std::size_t begin, std::size_t count, Function && function)
+    {
+        Element block[fusedBlockSize];
+        evaluateBlock<Element>(node, begin, count, block);
+        function(ArrayOperand<Element>{block});
+    }
+
+    //! Evaluate the elements `begin` to `begin+count` of an expression of vectors into `out`
+    template<typename Element, typename Operation, typename ElementOperation, typename Lhs, typename Rhs>
+    static void evaluateBlock(
+        const BinaryNode<Operation,ElementOperation,Lhs,Rhs> & node, std::size_t begin, std::size_t count, Element * out)
+    {
+        withOperand<Element>(node.lhs, begin, count, [&](auto lhs){
+            withOperand<Element>(node.rhs, begin, count, [&](auto rhs){
+                elementwiseLoop<ElementOperation>(out, lhs, rhs, count);
+            });
+        });
+    }
+
+    Node node_;
+}; // GeneralExpression<GenType,Node>
+
+//! Start a lazily evaluated expression with the GeneralType `genT`
+template<typename ErrorPolicy, typename ... Types_>
+auto lazy(const BasicGeneralType<ErrorPolicy,Types_...> & genT){
+    using GenType = BasicGeneralType<ErrorPolicy,Types_...>;
+    return GeneralExpression<GenType,LeafNode<GenType>>(LeafNode<GenType>{genT});
+}
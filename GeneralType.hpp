@@ -7,11 +7,22 @@
 #include<concepts>
 #include<complex>
 #include<vector>
+#include<array>
+#include<string>
+#include<utility>
+#include<tuple>
+#include<initializer_list>
+#include<span>
+#include<algorithm>
+#include<stdexcept>
+#include<cassert>
 
 #include <cstdlib>
 #include <memory>
 #include <cxxabi.h>
 
+#include "VectorOperators.hpp"
+
 
 //! A function to convert a Type to a string representation.
 // ToDo: This requires a lot hard coding, can we automate this?
@@ -33,6 +44,8 @@ std::string typeToString(){
     if constexpr( std::is_same_v<Type,std::vector<double>>){return "vector<double>";}
     if constexpr( std::is_same_v<Type,std::vector<std::complex<float>>>){return "vector<complex<float>>";}
     if constexpr( std::is_same_v<Type,std::vector<std::complex<double>>>){return "vector<complex<double>>";}
+
+    if constexpr( std::is_same_v<Type,std::string>){return "string";}
     // ...
 
     // If type has no explicit implementation we just use the c++ type name
@@ -250,89 +263,562 @@ concept areAccessible = requires(T t, U key) {
     { t[key] } -> std::convertible_to<decltype(t[key])>;
 };
 
+
+// The following structs bundle an operator of the held types with the concept that checks its
+// availability and its name for error messages. They are used to streamline the operators of
+// the GeneralType to a single implementation. The arithmetic operators, the ordering comparisons and
+// their compound assignments fall back to the element wise operators of VectorOperators.hpp for
+// std::vectors of numeric elements; the comparisons prefer them over the lexicographic ones of std::vector.
+
+//! Addition `operator+`
+struct AdditionOperator {
+    static constexpr const char * name = "operator+";
+    template<typename T, typename U> static constexpr bool isSupported = areAddable<T,U> || areElementwise<ElementwiseAddition,T,U>;
+    template<typename T, typename U> static decltype(auto) apply(T && t, U && u){
+        if constexpr( areAddable<T,U> ){ return std::forward<T>(t) + std::forward<U>(u); }
+        else { return elementwise<ElementwiseAddition>(t,u); }
+    }
+};
+
+//! Subtraction `operator-`
+struct SubtractionOperator {
+    static constexpr const char * name = "operator-";
+    template<typename T, typename U> static constexpr bool isSupported = areSubtractable<T,U> || areElementwise<ElementwiseSubtraction,T,U>;
+    template<typename T, typename U> static decltype(auto) apply(T && t, U && u){
+        if constexpr( areSubtractable<T,U> ){ return std::forward<T>(t) - std::forward<U>(u); }
+        else { return elementwise<ElementwiseSubtraction>(t,u); }
+    }
+};
+
+//! Multiplication `operator*`
+struct MultiplicationOperator {
+    static constexpr const char * name = "operator*";
+    template<typename T, typename U> static constexpr bool isSupported = areMultipliable<T,U> || areElementwise<ElementwiseMultiplication,T,U>;
+    template<typename T, typename U> static decltype(auto) apply(T && t, U && u){
+        if constexpr( areMultipliable<T,U> ){ return std::forward<T>(t) * std::forward<U>(u); }
+        else { return elementwise<ElementwiseMultiplication>(t,u); }
+    }
+};
+
+//! Division `operator/`
+struct DivisionOperator {
+    static constexpr const char * name = "operator/";
+    template<typename T, typename U> static constexpr bool isSupported = areDivisible<T,U> || areElementwise<ElementwiseDivision,T,U>;
+    template<typename T, typename U> static decltype(auto) apply(T && t, U && u){
+        if constexpr( areDivisible<T,U> ){ return std::forward<T>(t) / std::forward<U>(u); }
+        else { return elementwise<ElementwiseDivision>(t,u); }
+    }
+};
+
+//! Modulus `operator%`
+struct ModulusOperator {
+    static constexpr const char * name = "operator%";
+    template<typename T, typename U> static constexpr bool isSupported = areModulus<T,U>;
+    template<typename T, typename U> static decltype(auto) apply(T && t, U && u){ return std::forward<T>(t) % std::forward<U>(u); }
+};
+
+//! Bitwise AND `operator&`
+struct BitwiseAndOperator {
+    static constexpr const char * name = "operator&";
+    template<typename T, typename U> static constexpr bool isSupported = areBitwiseAndable<T,U>;
+    template<typename T, typename U> static decltype(auto) apply(T && t, U && u){ return std::forward<T>(t) & std::forward<U>(u); }
+};
+
+//! Logical AND `operator&&`
+struct LogicalAndOperator {
+    static constexpr const char * name = "operator&&";
+    template<typename T, typename U> static constexpr bool isSupported = areLogicalAndable<T,U>;
+    template<typename T, typename U> static decltype(auto) apply(T && t, U && u){ return std::forward<T>(t) && std::forward<U>(u); }
+};
+
+//! Exclusive OR `operator^`
+struct ExclusiveOrOperator {
+    static constexpr const char * name = "operator^";
+    template<typename T, typename U> static constexpr bool isSupported = areExclusiveOrable<T,U>;
+    template<typename T, typename U> static decltype(auto) apply(T && t, U && u){ return std::forward<T>(t) ^ std::forward<U>(u); }
+};
+
+//! Bitwise inclusive OR `operator|`
+struct BitwiseInclusiveOrOperator {
+    static constexpr const char * name = "operator|";
+    template<typename T, typename U> static constexpr bool isSupported = areBitwiseInclusiveOrable<T,U>;
+    template<typename T, typename U> static decltype(auto) apply(T && t, U && u){ return std::forward<T>(t) | std::forward<U>(u); }
+};
+
+//! Logical inclusive OR `operator||`
+struct LogicalInclusiveOrOperator {
+    static constexpr const char * name = "operator||";
+    template<typename T, typename U> static constexpr bool isSupported = areLogicalInclusiveOrable<T,U>;
+    template<typename T, typename U> static decltype(auto) apply(T && t, U && u){ return std::forward<T>(t) || std::forward<U>(u); }
+};
+
+//! Smaller comparison `operator<`
+struct SmallerComparisonOperator {
+    static constexpr const char * name = "operator<";
+    template<typename T, typename U> static constexpr bool isSupported = areElementwise<ElementwiseSmaller,T,U> || areSmallerComparable<T,U>;
+    template<typename T, typename U> static decltype(auto) apply(T && t, U && u){
+        if constexpr( areElementwise<ElementwiseSmaller,T,U> ){ return elementwise<ElementwiseSmaller>(t,u); }
+        else { return std::forward<T>(t) < std::forward<U>(u); }
+    }
+};
+
+//! Larger comparison `operator>`
+struct LargerComparisonOperator {
+    static constexpr const char * name = "operator>";
+    template<typename T, typename U> static constexpr bool isSupported = areElementwise<ElementwiseLarger,T,U> || areLargerComparable<T,U>;
+    template<typename T, typename U> static decltype(auto) apply(T && t, U && u){
+        if constexpr( areElementwise<ElementwiseLarger,T,U> ){ return elementwise<ElementwiseLarger>(t,u); }
+        else { return std::forward<T>(t) > std::forward<U>(u); }
+    }
+};
+
+//! Smaller equal comparison `operator<=`
+struct SmallerEqualComparisonOperator {
+    static constexpr const char * name = "operator<=";
+    template<typename T, typename U> static constexpr bool isSupported = areElementwise<ElementwiseSmallerEqual,T,U> || areSmallerEqualComparable<T,U>;
+    template<typename T, typename U> static decltype(auto) apply(T && t, U && u){
+        if constexpr( areElementwise<ElementwiseSmallerEqual,T,U> ){ return elementwise<ElementwiseSmallerEqual>(t,u); }
+        else { return std::forward<T>(t) <= std::forward<U>(u); }
+    }
+};
+
+//! Larger equal comparison `operator>=`
+struct LargerEqualComparisonOperator {
+    static constexpr const char * name = "operator>=";
+    template<typename T, typename U> static constexpr bool isSupported = areElementwise<ElementwiseLargerEqual,T,U> || areLargerEqualComparable<T,U>;
+    template<typename T, typename U> static decltype(auto) apply(T && t, U && u){
+        if constexpr( areElementwise<ElementwiseLargerEqual,T,U> ){ return elementwise<ElementwiseLargerEqual>(t,u); }
+        else { return std::forward<T>(t) >= std::forward<U>(u); }
+    }
+};
+
+//! Equality comparison `operator==`
+struct EqualityComparisonOperator {
+    static constexpr const char * name = "operator==";
+    template<typename T, typename U> static constexpr bool isSupported = areEqualityComparable<T,U>;
+    template<typename T, typename U> static decltype(auto) apply(T && t, U && u){ return std::forward<T>(t) == std::forward<U>(u); }
+};
+
+//! Inequality comparison `operator!=`
+struct InequalityComparisonOperator {
+    static constexpr const char * name = "operator!=";
+    template<typename T, typename U> static constexpr bool isSupported = areInequalityComparable<T,U>;
+    template<typename T, typename U> static decltype(auto) apply(T && t, U && u){ return std::forward<T>(t) != std::forward<U>(u); }
+};
+
+//! Add assignment `operator+=`
+struct AddAssignmentOperator {
+    static constexpr const char * name = "operator+=";
+    using Binary = AdditionOperator;
+    template<typename T, typename U> static constexpr bool isSupported = areAddAssignable<T,U> || areElementwiseAssignable<ElementwiseAddition,T,U>;
+    template<typename T, typename U> static decltype(auto) apply(T & t, U && u){
+        if constexpr( areAddAssignable<T,U> ){ return t += std::forward<U>(u); }
+        else { elementwiseAssign<ElementwiseAddition>(t,u); return (t); }
+    }
+};
+
+//! Subtract assignment `operator-=`
+struct SubtractAssignmentOperator {
+    static constexpr const char * name = "operator-=";
+    using Binary = SubtractionOperator;
+    template<typename T, typename U> static constexpr bool isSupported = areSubtractAssignable<T,U> || areElementwiseAssignable<ElementwiseSubtraction,T,U>;
+    template<typename T, typename U> static decltype(auto) apply(T & t, U && u){
+        if constexpr( areSubtractAssignable<T,U> ){ return t -= std::forward<U>(u); }
+        else { elementwiseAssign<ElementwiseSubtraction>(t,u); return (t); }
+    }
+};
+
+//! Multiply assignment `operator*=`
+struct MultiplyAssignmentOperator {
+    static constexpr const char * name = "operator*=";
+    using Binary = MultiplicationOperator;
+    template<typename T, typename U> static constexpr bool isSupported = areMultiplyAssignable<T,U> || areElementwiseAssignable<ElementwiseMultiplication,T,U>;
+    template<typename T, typename U> static decltype(auto) apply(T & t, U && u){
+        if constexpr( areMultiplyAssignable<T,U> ){ return t *= std::forward<U>(u); }
+        else { elementwiseAssign<ElementwiseMultiplication>(t,u); return (t); }
+    }
+};
+
+//! Division assignment `operator/=`
+struct DivisionAssignmentOperator {
+    static constexpr const char * name = "operator/=";
+    using Binary = DivisionOperator;
+    template<typename T, typename U> static constexpr bool isSupported = areDivisionAssignable<T,U> || areElementwiseAssignable<ElementwiseDivision,T,U>;
+    template<typename T, typename U> static decltype(auto) apply(T & t, U && u){
+        if constexpr( areDivisionAssignable<T,U> ){ return t /= std::forward<U>(u); }
+        else { elementwiseAssign<ElementwiseDivision>(t,u); return (t); }
+    }
+};
+
+//! Modulus assignment `operator%=`
+struct ModulusAssignmentOperator {
+    static constexpr const char * name = "operator%=";
+    using Binary = ModulusOperator;
+    template<typename T, typename U> static constexpr bool isSupported = areModulusAssignable<T,U>;
+    template<typename T, typename U> static decltype(auto) apply(T & t, U && u){ return t %= std::forward<U>(u); }
+};
+
+//! Bitwise AND assignment `operator&=`
+struct BitwiseAndAssignmentOperator {
+    static constexpr const char * name = "operator&=";
+    using Binary = BitwiseAndOperator;
+    template<typename T, typename U> static constexpr bool isSupported = areBitwiseAndAssignable<T,U>;
+    template<typename T, typename U> static decltype(auto) apply(T & t, U && u){ return t &= std::forward<U>(u); }
+};
+
+//! Bitwise inclusive OR assignment `operator|=`
+struct BitwiseInclusiveOrAssignmentOperator {
+    static constexpr const char * name = "operator|=";
+    using Binary = BitwiseInclusiveOrOperator;
+    template<typename T, typename U> static constexpr bool isSupported = areBitwiseInclusiveOrAssignable<T,U>;
+    template<typename T, typename U> static decltype(auto) apply(T & t, U && u){ return t |= std::forward<U>(u); }
+};
+
+//! Exclusive OR assignment `operator^=`
+struct ExclusiveOrAssignmentOperator {
+    static constexpr const char * name = "operator^=";
+    using Binary = ExclusiveOrOperator;
+    template<typename T, typename U> static constexpr bool isSupported = areExclusiveOrAssignable<T,U>;
+    template<typename T, typename U> static decltype(auto) apply(T & t, U && u){ return t ^= std::forward<U>(u); }
+};
+
+//! Right shift assignment `operator>>=`
+struct RightShiftAssignmentOperator {
+    static constexpr const char * name = "operator>>=";
+    template<typename T, typename U> static constexpr bool isSupported = areRightShiftAssignable<T,U>;
+    template<typename T, typename U> static decltype(auto) apply(T & t, U && u){ return t >>= std::forward<U>(u); }
+};
+
+//! Left shift assignment `operator<<=`
+struct LeftShiftAssignmentOperator {
+    static constexpr const char * name = "operator<<=";
+    template<typename T, typename U> static constexpr bool isSupported = areLeftShiftAssignable<T,U>;
+    template<typename T, typename U> static decltype(auto) apply(T & t, U && u){ return t <<= std::forward<U>(u); }
+};
+
+//! The type of `+t` for a `t` of type `T`, i.e. `T` after integral promotion, or `T` if it has no unary plus
+template<typename T>
+struct UnaryPromoted { using type = std::remove_cvref_t<T>; };
+
+template<typename T>
+    requires requires(T t){ +t; }
+struct UnaryPromoted<T> { using type = std::remove_cvref_t<decltype(+std::declval<T>())>; };
+
+//! Checks if a `From` can be converted to `Type`, implicitly or by an explicit constructor
+template<typename From, typename Type>
+constexpr bool isConvertibleTo = std::is_convertible_v<From,Type> || std::is_constructible_v<Type,From>;
+
+//! A list of types, used to pass several parameter packs to a template
+template<typename ... Types>
+struct TypeList {};
+
+//! Checks if `Operation` is supported for `Lhs` and any of the types `Rhs...`
+template<typename Operation, typename Lhs, typename ... Rhs>
+constexpr bool isSupportedForAnyRhs = (Operation::template isSupported<Lhs,Rhs> || ...);
+
+//! Checks if `Operation` is supported for any pair of types from `LhsList` and `RhsList`
+template<typename Operation, typename LhsList, typename RhsList>
+constexpr bool isSupportedForAnyPair = false;
+
+template<typename Operation, typename ... Lhs, typename ... Rhs>
+constexpr bool isSupportedForAnyPair<Operation,TypeList<Lhs...>,TypeList<Rhs...>> = 
+    (isSupportedForAnyRhs<Operation,Lhs,Rhs...> || ...);
+
+//! Index of `Type` in the list `Types...`, `sizeof...(Types)` if it is not contained
+template<typename Type, typename ... Types>
+constexpr std::size_t indexOfType(){
+    std::size_t index = 0;
+    bool found = false;
+    ((found = found || std::is_same_v<Type,Types>, index += found ? 0 : 1), ...);
+    return index;
+}
+
 } // namespace 
 
+// Containers of GeneralTypes, see GeneralVector.hpp
+template<typename ErrorPolicy, typename ... Types_>
+class BasicGeneralVector;
+
+// Lazily evaluated expressions of GeneralTypes, see GeneralExpression.hpp
+template<typename GenType, typename Node>
+class GeneralExpression;
+
+// Binary serialization of GeneralTypes, see BinaryFormat.hpp
+template<typename GenType>
+struct BinaryFormat;
+
+// Non-owning references to the held objects of GeneralTypes, see GeneralTypeRef.hpp
+template<typename GenType, bool Const>
+class BasicGeneralTypeRef;
+
+// Memory mapped dictionaries of GeneralTypes, see Snapshot.hpp
+template<typename GenType>
+struct SnapshotFormat;
+
+// JSON text of GeneralTypes, see JsonFormat.hpp
+template<typename GenType>
+struct JsonFormat;
+
+// 16 byte storage of the objects held by GeneralTypes, see CompactGeneralType.hpp
+template<typename GenType>
+class BasicCompactGeneralType;
+
+// 8 byte storage of the scalars held by GeneralTypes, see NanBoxedGeneralType.hpp
+template<typename GenType>
+class BasicNanBoxedGeneralType;
+
+// Lock-free atomic storage of the scalars held by GeneralTypes, see AtomicGeneralType.hpp
+template<typename GenType>
+class BasicAtomicGeneralType;
+
+//! Error policy of `GeneralType`: Operators and conversions that are not defined for the held 
+//! type(s) throw a `std::runtime_error` naming the involved types.
+struct RuntimeErrorPolicy {
+    //! Operators that are not defined for any of the types are still declared
+    static constexpr bool rejectAtCompileTime = false;
+
+    //! Report an operator not defined for the held type(s), `message` creates the error message
+    template<typename MessageFunction>
+    [[noreturn]] static void unsupported(MessageFunction && message){
+        throw std::runtime_error(message());
+    }
+};
+
+//! Error policy of `StrictGeneralType`: Operators and conversions that are not defined for any 
+//! of the types fail to compile. Pairs of held types an operator is not defined for are 
+//! collapsed onto a single entry throwing `std::bad_variant_access`, no error message is created.
+struct StrictErrorPolicy {
+    //! Operators that are not defined for any of the types are not declared
+    static constexpr bool rejectAtCompileTime = true;
+
+    //! Report an operator not defined for the held type(s), `message` is never invoked
+    template<typename MessageFunction>
+    [[noreturn]] static void unsupported(MessageFunction &&){
+        throw std::bad_variant_access();
+    }
+};
+
 /*! 
  * Implementation of a holder class that can hold any of the types specified in the template parameter pack
  * It is a wrapper around the std::variant class that implements a type cast operator to the desired type as well as some convenience functions for simpler usage
+ * The `ErrorPolicy` decides how operators that are not defined for the held types are handled, 
+ * use the aliases `GeneralType` and `StrictGeneralType` below.
  */
-template<typename ... Types_>
-class GeneralType{
+template<typename ErrorPolicy, typename ... Types_>
+class BasicGeneralType{
+    protected:
+    //! The type of the underlying `std::variant`
+    using Variant = std::variant<long int, Types_...>;
+
+    // The following traits decide which operators are declared. Only the listed `Types_` are 
+    // considered, not the internal `long int` alternative.
+
+    //! A binary operator is declared unless the `ErrorPolicy` rejects operators that are not 
+    //! defined for any pair of alternatives at compile time
+    template<typename Operation>
+    static constexpr bool declaresBinary = !ErrorPolicy::rejectAtCompileTime 
+        || isSupportedForAnyPair<Operation,
+            TypeList<const Types_ &...>, TypeList<const Types_ &...>
+        >;
+
+    //! A compound assignment operator is declared unless the `ErrorPolicy` rejects operators 
+    //! that are not defined for any pair of alternatives at compile time
+    template<typename Operation>
+    static constexpr bool declaresAssignment = !ErrorPolicy::rejectAtCompileTime 
+        || isSupportedForAnyPair<Operation,
+            TypeList<Types_ &...>, TypeList<const Types_ &...>
+        >;
+
+    //! An operator with a non-GeneralType `Type` on the left is declared unless the `ErrorPolicy` 
+    //! rejects operators that are not defined for `Type` and any alternative at compile time
+    template<typename Operation, typename Type>
+    static constexpr bool declaresMixed = !ErrorPolicy::rejectAtCompileTime 
+        || isSupportedForAnyRhs<Operation, const Type &, const Types_ &...>;
+
+    //! A conversion to `Type` is declared unless the `ErrorPolicy` rejects conversions that are not
+    //! defined for any of the `Alternatives`, the types of the GeneralType with a qualification, at compile time
+    template<typename Type, typename ... Alternatives>
+    static constexpr bool declaresConversion = !ErrorPolicy::rejectAtCompileTime 
+        || (isConvertibleTo<Alternatives,Type> || ...);
+
     public:
     //! Default-construct a `GeneralType`
-    GeneralType() = default;
+    BasicGeneralType() = default;
 
     //! Copy-construct a `GeneralType`
-    GeneralType( const GeneralType<Types_...> & genT) = default;
+    BasicGeneralType( const BasicGeneralType & genT) = default;
 
     //! Move-construct a `GeneralType`
-    GeneralType( GeneralType<Types_...> && genT) = default;
+    BasicGeneralType( BasicGeneralType && genT) = default;
 
     //! Copy-assign a `GeneralType`
-    GeneralType<Types_...> & operator=( const GeneralType<Types_...> & genT) = default;
+    BasicGeneralType & operator=( const BasicGeneralType & genT) = default;
 
     //! Move-assign a `GeneralType`
-    GeneralType<Types_...> & operator=( GeneralType<Types_...> && genT) = default;
+    BasicGeneralType & operator=( BasicGeneralType && genT) = default;
 
-    //! Copy-Construct the GeneralType<Types...> from an object with type Type;
+    //! Construct the GeneralType<Types...> from an object with type Type, which is copied from
+    //! l-values and moved from r-values
     template<typename Type>
-    GeneralType( const Type & obj ) :
-        obj_(obj)
+        requires( !std::is_same_v<std::remove_cvref_t<Type>,BasicGeneralType> && std::is_constructible_v<Variant, Type> )
+    BasicGeneralType( Type && obj ) :
+        obj_(std::forward<Type>(obj))
     {}
 
-    //! Move-Construct the GeneralType<Types...> from an object with type Type;
+    //! Assign an object with type Type, which is copied from l-values and moved from r-values.
+    //! If the GeneralType holds the same type already, the held object is assigned to.
     template<typename Type>
-    GeneralType( Type && obj ) :
-        obj_(std::move(obj))
-    {}
+        requires( !std::is_same_v<std::remove_cvref_t<Type>,BasicGeneralType> && std::is_constructible_v<Variant, Type> )
+    BasicGeneralType & operator=( Type && obj ){
+        constexpr std::size_t index = indexOfType<std::remove_cvref_t<Type>, long int, Types_...>();
+        if constexpr( index < sizeof...(Types_) + 1 ){
+            // std::variant would copy into a temporary and move it, if the copy may throw but the move does not
+            if( obj_.index() == index ){
+                *std::get_if<index>(&obj_) = std::forward<Type>(obj);
+            } else {
+                obj_.template emplace<index>(std::forward<Type>(obj));
+            }
+        } else {
+            obj_ = std::forward<Type>(obj);
+        }
+        return *this;
+    }
+
+    //! Construct an object of type `Type` from `args` in place of the held object and return it
+    template<typename Type, typename ... Args>
+        requires( indexOfType<Type, long int, Types_...>() < sizeof...(Types_) + 1 && std::is_constructible_v<Type, Args...> )
+    Type & emplace( Args && ... args ){
+        return obj_.template emplace<indexOfType<Type, long int, Types_...>()>(std::forward<Args>(args)...);
+    }
 
-    //! Copy-assign the GeneralType<Types...> from an object with type Type;
+    //! Construct an object of type `Type` from an initializer list and `args` in place of the held object
+    template<typename Type, typename Element, typename ... Args>
+        requires( indexOfType<Type, long int, Types_...>() < sizeof...(Types_) + 1
+            && std::is_constructible_v<Type, std::initializer_list<Element> &, Args...> )
+    Type & emplace( std::initializer_list<Element> elements, Args && ... args ){
+        return obj_.template emplace<indexOfType<Type, long int, Types_...>()>(elements, std::forward<Args>(args)...);
+    }
+
+    //! Construct the object of type `Type` returned by `function(args...)` in place of the held object.
+    //! The returned object is not moved, e.g. a vector filled by a function is stored without a copy or move.
+    template<typename Type, typename Function, typename ... Args>
+        requires( indexOfType<Type, long int, Types_...>() < sizeof...(Types_) + 1
+            && std::is_same_v<std::invoke_result_t<Function, Args...>, Type> )
+    Type & emplace_with( Function && function, Args && ... args ){
+        // converting to `Type` calls `function`, the returned prvalue initializes the alternative directly
+        struct Result {
+            Function && function;
+            std::tuple<Args && ...> args;
+            operator Type() && {
+                return std::apply(std::forward<Function>(function), std::move(args));
+            }
+        };
+        return obj_.template emplace<indexOfType<Type, long int, Types_...>()>(
+            Result{std::forward<Function>(function), std::forward_as_tuple(std::forward<Args>(args)...)}
+        );
+    }
+
+    //! A pointer to the held object if it has the type `Type`, a `nullptr` otherwise
     template<typename Type>
-    GeneralType<Types_...> & operator=( const Type & obj ){
-        obj_ = obj;
-        return *this;
+        requires( indexOfType<Type, long int, Types_...>() < sizeof...(Types_) + 1 )
+    Type * get_if() noexcept {
+        return std::get_if<indexOfType<Type, long int, Types_...>()>(&obj_);
     }
 
-    //! Move-assign the GeneralType<Types...> from an object with type Type;
+    //! A pointer to the held object if it has the type `Type`, a `nullptr` otherwise
     template<typename Type>
-    GeneralType<Types_...> & operator=( Type && obj ){
-        obj_ = obj;
-        return *this;
+        requires( indexOfType<Type, long int, Types_...>() < sizeof...(Types_) + 1 )
+    const Type * get_if() const noexcept {
+        return std::get_if<indexOfType<Type, long int, Types_...>()>(&obj_);
+    }
+
+    //! The held object, throws a `std::bad_variant_access` if it has another type than `Type`.
+    //! In contrast to `operator Type()` the held object is never converted.
+    template<typename Type>
+        requires( indexOfType<Type, long int, Types_...>() < sizeof...(Types_) + 1 )
+    Type & get() & {
+        return std::get<indexOfType<Type, long int, Types_...>()>(obj_);
+    }
+
+    template<typename Type>
+        requires( indexOfType<Type, long int, Types_...>() < sizeof...(Types_) + 1 )
+    const Type & get() const & {
+        return std::get<indexOfType<Type, long int, Types_...>()>(obj_);
+    }
+
+    template<typename Type>
+        requires( indexOfType<Type, long int, Types_...>() < sizeof...(Types_) + 1 )
+    Type && get() && {
+        return std::get<indexOfType<Type, long int, Types_...>()>(std::move(obj_));
+    }
+
+    //! The held object without checking its type, which has to be `Type`. Only builds without
+    //! `NDEBUG` check the type, by an assertion.
+    template<typename Type>
+        requires( indexOfType<Type, long int, Types_...>() < sizeof...(Types_) + 1 )
+    Type & get_unchecked() & noexcept {
+        assert(obj_.index() == (indexOfType<Type, long int, Types_...>()));
+        return getUnchecked<indexOfType<Type, long int, Types_...>()>(obj_);
+    }
+
+    template<typename Type>
+        requires( indexOfType<Type, long int, Types_...>() < sizeof...(Types_) + 1 )
+    const Type & get_unchecked() const & noexcept {
+        assert(obj_.index() == (indexOfType<Type, long int, Types_...>()));
+        return getUnchecked<indexOfType<Type, long int, Types_...>()>(obj_);
+    }
+
+    template<typename Type>
+        requires( indexOfType<Type, long int, Types_...>() < sizeof...(Types_) + 1 )
+    Type && get_unchecked() && noexcept {
+        assert(obj_.index() == (indexOfType<Type, long int, Types_...>()));
+        return getUnchecked<indexOfType<Type, long int, Types_...>()>(std::move(obj_));
+    }
+
+    //! Invoke `visitor` with the held object, forwards to `std::visit` on the underlying variant.
+    //! The visitor has to accept the `long int` held by a default constructed GeneralType as well.
+    template<typename Visitor>
+    decltype(auto) visit( Visitor && visitor ) & {
+        return std::visit(std::forward<Visitor>(visitor), obj_);
+    }
+
+    template<typename Visitor>
+    decltype(auto) visit( Visitor && visitor ) const & {
+        return std::visit(std::forward<Visitor>(visitor), obj_);
+    }
+
+    template<typename Visitor>
+    decltype(auto) visit( Visitor && visitor ) && {
+        return std::visit(std::forward<Visitor>(visitor), std::move(obj_));
     }
 
     //! This operator decomposes the `GeneralType` into a given type potentially casting it
     template<typename Type>
+        requires( declaresConversion<Type, Types_ &...> )
     operator Type(){
-        return std::visit(
-            [](auto & e){
-                if constexpr (std::is_convertible_v<Type,decltype(e)>){
-                    return static_cast<Type>(e);
-                } else if constexpr (std::is_constructible_v<Type,decltype(e)>){
-                    return Type(e);
-                } else {
-                    throw std::runtime_error(
-                        "Can not convert held type ("
-                        + typeToString<decltype(e)>()
-                        +") to desired Type ("+typeToString<Type>()+")"
-                    );
-                    return Type();
-                }
-            },
-            obj_
-        );
+        return conversionOperator<Type>(*this);
+    }
+
+    //! This operator decomposes a constant `GeneralType` into a given type potentially casting it
+    template<typename Type>
+        requires( declaresConversion<Type, const Types_ &...> )
+    operator Type() const {
+        return conversionOperator<Type>(*this);
     }
 
     //! An implementation that puts the content of `GeneralType` to the out stream `os`
-    friend std::ostream & operator<< (std::ostream & os, GeneralType<Types_...> genT){
+    friend std::ostream & operator<< (std::ostream & os, const BasicGeneralType & genT)
+        requires( !ErrorPolicy::rejectAtCompileTime || (hasStreamingOperator<const Types_&> || ...) )
+    {
         std::visit(
-            [&os,&genT](auto & arg){
+            [&os](const auto & arg){
                 if constexpr (hasStreamingOperator<decltype(arg)>){
                     os << arg;
                 } else {
-                    throw std::runtime_error(
-                        "Can not  invoke operator<< held type (" 
-                        + typeToString<decltype(arg)>() + ")"
-                    );
+                    ErrorPolicy::unsupported([]{
+                        return "Can not  invoke operator<< held type (" 
+                            + typeToString<std::remove_cvref_t<decltype(arg)>>() + ")";
+                    });
                 }
             },
             genT.obj_
@@ -342,24 +828,26 @@ class GeneralType{
     }
 
     // The following part of this class implements different operators that can come in handy. The general idea is
-    // if the contained type implements the operator then the General Type should call that otherwise evaluate a static_assert
+    // if the contained type implements the operator then the General Type should call that otherwise the 
+    // ErrorPolicy decides if a runtime error is thrown or the operator is not available at all
 
     // =========================================================================================
     // Unary Operators
     // =========================================================================================
     
     //! Negation operator, forwards to the negation operator of the held type
-    GeneralType<Types_...> operator!(){
+    BasicGeneralType operator!()
+        requires( !ErrorPolicy::rejectAtCompileTime || (hasNegationOperator<const Types_&> || ...) )
+    {
         return std::visit(
-            [](const auto & arg){
+            [](const auto & arg) -> BasicGeneralType {
                 if constexpr( hasNegationOperator<decltype(arg)> ){
-                    return GeneralType<Types_...>(!arg);
+                    return BasicGeneralType(!arg);
                 } else {
-                    throw std::runtime_error(
-                        "Can not invoke operator! on held type (" 
-                        + typeToString<decltype(arg)>() + ")"
-                    );
-                    return GeneralType<Types_...>(arg);
+                    ErrorPolicy::unsupported([]{
+                        return "Can not invoke operator! on held type (" 
+                            + typeToString<std::remove_cvref_t<decltype(arg)>>() + ")";
+                    });
                 }
             },
             this->obj_
@@ -367,17 +855,18 @@ class GeneralType{
     }
 
     //! Dereference operator, forwards to the dereference operator of the held type
-    GeneralType<Types_...> operator*(){
+    BasicGeneralType operator*()
+        requires( !ErrorPolicy::rejectAtCompileTime || (hasDereferenceOperator<const Types_&> || ...) )
+    {
         return std::visit(
-            [](const auto & arg){
+            [](const auto & arg) -> BasicGeneralType {
                 if constexpr( hasDereferenceOperator<decltype(arg)> ){
-                    return GeneralType<Types_...>(*arg);
+                    return BasicGeneralType(*arg);
                 } else {
-                    throw std::runtime_error(
-                        "Can not invoke operator! on held type (" 
-                        + typeToString<decltype(arg)>() + ")"
-                    );
-                    return GeneralType<Types_...>(arg);
+                    ErrorPolicy::unsupported([]{
+                        return "Can not invoke operator* on held type (" 
+                            + typeToString<std::remove_cvref_t<decltype(arg)>>() + ")";
+                    });
                 }
             },
             this->obj_
@@ -385,71 +874,75 @@ class GeneralType{
     }
 
     //! Prefix increment operator, forwards to the prefix increment operator of the held type
-    GeneralType<Types_...> operator++(){
+    BasicGeneralType operator++()
+        requires( !ErrorPolicy::rejectAtCompileTime || (hasPrefixIncrementOperator<Types_&> || ...) )
+    {
         return std::visit(
-            [](auto & arg){
+            [](auto & arg) -> BasicGeneralType {
                 if constexpr( hasPrefixIncrementOperator<decltype(arg)> ){
-                    return GeneralType<Types_...>(++arg);
+                    return BasicGeneralType(++arg);
                 } else {
-                    throw std::runtime_error(
-                        "Can not invoke prefix operator++ on held type (" 
-                        + typeToString<decltype(arg)>() + ")"
-                    );
-                    return GeneralType<Types_...>(arg);
+                    ErrorPolicy::unsupported([]{
+                        return "Can not invoke prefix operator++ on held type (" 
+                            + typeToString<std::remove_cvref_t<decltype(arg)>>() + ")";
+                    });
                 }
             },
             this->obj_
         );
     }
 
-    //! Postfix increment operator, forwards to the prefix increment operator of the held type
-    GeneralType<Types_...> operator++(int){
+    //! Postfix increment operator, forwards to the postfix increment operator of the held type
+    BasicGeneralType operator++(int)
+        requires( !ErrorPolicy::rejectAtCompileTime || (hasPostfixIncrementOperator<Types_&> || ...) )
+    {
         return std::visit(
-            [](auto & arg){
+            [](auto & arg) -> BasicGeneralType {
                 if constexpr( hasPostfixIncrementOperator<decltype(arg)> ){
-                    return GeneralType<Types_...>(arg++);
+                    return BasicGeneralType(arg++);
                 } else {
-                    throw std::runtime_error(
-                        "Can not invoke postfix operator++ on held type (" 
-                        + typeToString<decltype(arg)>() + ")"
-                    );
-                    return GeneralType<Types_...>(arg);
+                    ErrorPolicy::unsupported([]{
+                        return "Can not invoke postfix operator++ on held type (" 
+                            + typeToString<std::remove_cvref_t<decltype(arg)>>() + ")";
+                    });
                 }
             },
             this->obj_
         );
     }
 
-    //! Prefix decrement operator, forwards to the prefix increment operator of the held type
-    GeneralType<Types_...> operator--(){
+    //! Prefix decrement operator, forwards to the prefix decrement operator of the held type
+    BasicGeneralType operator--()
+        requires( !ErrorPolicy::rejectAtCompileTime || (hasPrefixDecrementOperator<Types_&> || ...) )
+    {
         return std::visit(
-            [](auto & arg){
-                if constexpr( hasPrefixIncrementOperator<decltype(arg)> ){
-                    return GeneralType<Types_...>(--arg);
+            [](auto & arg) -> BasicGeneralType {
+                if constexpr( hasPrefixDecrementOperator<decltype(arg)> ){
+                    return BasicGeneralType(--arg);
                 } else {
-                    throw std::runtime_error(
-                        "Can not invoke prefix operator++ on held type (" 
-                        + typeToString<decltype(arg)>() + ")"
-                    );
-                    return GeneralType<Types_...>(arg);
+                    ErrorPolicy::unsupported([]{
+                        return "Can not invoke prefix operator-- on held type (" 
+                            + typeToString<std::remove_cvref_t<decltype(arg)>>() + ")";
+                    });
                 }
             },
             this->obj_
         );
     }
 
-    //! Postfix decrement operator, forwards to the prefix increment operator of the held type
-    GeneralType<Types_...> operator--(int){
+    //! Postfix decrement operator, forwards to the postfix decrement operator of the held type
+    BasicGeneralType operator--(int)
+        requires( !ErrorPolicy::rejectAtCompileTime || (hasPostfixDecrementOperator<Types_&> || ...) )
+    {
         return std::visit(
-            [](auto & arg){
-                if constexpr( hasPostfixIncrementOperator<decltype(arg)> ){
-                    return GeneralType<Types_...>(arg--);
+            [](auto & arg) -> BasicGeneralType {
+                if constexpr( hasPostfixDecrementOperator<decltype(arg)> ){
+                    return BasicGeneralType(arg--);
                 } else {
-                    throw std::runtime_error(
-                        "Can not invoke postfix operator++ on held type (" 
-                        + typeToString<decltype(arg)>() + ")"
-                    );
-                    return GeneralType<Types_...>(arg);
+                    ErrorPolicy::unsupported([]{
+                        return "Can not invoke postfix operator-- on held type (" 
+                            + typeToString<std::remove_cvref_t<decltype(arg)>>() + ")";
+                    });
                 }
             },
             this->obj_
@@ -458,17 +951,18 @@ class GeneralType{
 
 
     //! Access operator, forwards to the access operator of the held type
-    GeneralType<Types_...> operator[](const auto & key){
+    template<typename Key>
+        requires( !ErrorPolicy::rejectAtCompileTime || (areAccessible<Types_&,const Key &> || ...) )
+    BasicGeneralType operator[](const Key & key){
         return std::visit(
-            [&key](auto & arg){
+            [&key](auto & arg) -> BasicGeneralType {
                 if constexpr( areAccessible<decltype(arg),decltype(key)> ){
-                    return GeneralType<Types_...>(arg[key]);
+                    return BasicGeneralType(arg[key]);
                 } else {
-                    throw std::runtime_error(
-                        "Can not invoke operator[] on held type (" 
-                        + typeToString<decltype(arg)>() + ")"
-                    );
-                    return GeneralType<Types_...>(arg);
+                    ErrorPolicy::unsupported([]{
+                        return "Can not invoke operator[] on held type (" 
+                            + typeToString<std::remove_cvref_t<decltype(arg)>>() + ")";
+                    });
                 }
             },
             this->obj_
@@ -476,17 +970,18 @@ class GeneralType{
     }
 
     //! const Access operator, forwards to the access operator of the held type
-    GeneralType<Types_...> operator[](const auto & key) const {
+    template<typename Key>
+        requires( !ErrorPolicy::rejectAtCompileTime || (areAccessible<const Types_&,const Key &> || ...) )
+    BasicGeneralType operator[](const Key & key) const {
         return std::visit(
-            [&key](auto & arg){
+            [&key](auto & arg) -> BasicGeneralType {
                 if constexpr( areAccessible<decltype(arg),decltype(key)> ){
-                    return GeneralType<Types_...>(arg[key]);
+                    return BasicGeneralType(arg[key]);
                 } else {
-                    throw std::runtime_error(
-                        "Can not invoke operator[] on held type (" 
-                        + typeToString<decltype(arg)>() + ")"
-                    );
-                    return GeneralType<Types_...>(arg);
+                    ErrorPolicy::unsupported([]{
+                        return "Can not invoke operator[] on held type (" 
+                            + typeToString<std::remove_cvref_t<decltype(arg)>>() + ")";
+                    });
                 }
             },
             this->obj_
@@ -497,1019 +992,852 @@ class GeneralType{
     // =========================================================================================
     // Binary Operators
     // =========================================================================================
+    // Every binary operator comes in four overloads such that neither side is copied. If one
+    // side is an r-value its held object is moved into the operator of the held types, which
+    // allows e.g. `std::move(a) + b` to reuse the buffer of `a` for the result.
+
+    //! Addition operator, forwards to the addition operator of the held types
+    BasicGeneralType operator+(const BasicGeneralType & rhs) const & requires(declaresBinary<AdditionOperator>) { return binaryOperator<AdditionOperator>(*this,rhs); }
+    BasicGeneralType operator+(const BasicGeneralType & rhs) && requires(declaresBinary<AdditionOperator>) { return binaryOperator<AdditionOperator>(std::move(*this),rhs); }
+    BasicGeneralType operator+(BasicGeneralType && rhs) const & requires(declaresBinary<AdditionOperator>) { return binaryOperator<AdditionOperator>(*this,std::move(rhs)); }
+    BasicGeneralType operator+(BasicGeneralType && rhs) && requires(declaresBinary<AdditionOperator>) { return binaryOperator<AdditionOperator>(std::move(*this),std::move(rhs)); }
+
+    //! Subtraction operator, forwards to the subtraction operator of the held types
+    BasicGeneralType operator-(const BasicGeneralType & rhs) const & requires(declaresBinary<SubtractionOperator>) { return binaryOperator<SubtractionOperator>(*this,rhs); }
+    BasicGeneralType operator-(const BasicGeneralType & rhs) && requires(declaresBinary<SubtractionOperator>) { return binaryOperator<SubtractionOperator>(std::move(*this),rhs); }
+    BasicGeneralType operator-(BasicGeneralType && rhs) const & requires(declaresBinary<SubtractionOperator>) { return binaryOperator<SubtractionOperator>(*this,std::move(rhs)); }
+    BasicGeneralType operator-(BasicGeneralType && rhs) && requires(declaresBinary<SubtractionOperator>) { return binaryOperator<SubtractionOperator>(std::move(*this),std::move(rhs)); }
+
+    //! Multiplication operator, forwards to the multiplication operator of the held types
+    BasicGeneralType operator*(const BasicGeneralType & rhs) const & requires(declaresBinary<MultiplicationOperator>) { return binaryOperator<MultiplicationOperator>(*this,rhs); }
+    BasicGeneralType operator*(const BasicGeneralType & rhs) && requires(declaresBinary<MultiplicationOperator>) { return binaryOperator<MultiplicationOperator>(std::move(*this),rhs); }
+    BasicGeneralType operator*(BasicGeneralType && rhs) const & requires(declaresBinary<MultiplicationOperator>) { return binaryOperator<MultiplicationOperator>(*this,std::move(rhs)); }
+    BasicGeneralType operator*(BasicGeneralType && rhs) && requires(declaresBinary<MultiplicationOperator>) { return binaryOperator<MultiplicationOperator>(std::move(*this),std::move(rhs)); }
+
+    //! Division operator, forwards to the division operator of the held types
+    BasicGeneralType operator/(const BasicGeneralType & rhs) const & requires(declaresBinary<DivisionOperator>) { return binaryOperator<DivisionOperator>(*this,rhs); }
+    BasicGeneralType operator/(const BasicGeneralType & rhs) && requires(declaresBinary<DivisionOperator>) { return binaryOperator<DivisionOperator>(std::move(*this),rhs); }
+    BasicGeneralType operator/(BasicGeneralType && rhs) const & requires(declaresBinary<DivisionOperator>) { return binaryOperator<DivisionOperator>(*this,std::move(rhs)); }
+    BasicGeneralType operator/(BasicGeneralType && rhs) && requires(declaresBinary<DivisionOperator>) { return binaryOperator<DivisionOperator>(std::move(*this),std::move(rhs)); }
+
+    //! Modulus operator, forwards to the modulus operator of the held types
+    BasicGeneralType operator%(const BasicGeneralType & rhs) const & requires(declaresBinary<ModulusOperator>) { return binaryOperator<ModulusOperator>(*this,rhs); }
+    BasicGeneralType operator%(const BasicGeneralType & rhs) && requires(declaresBinary<ModulusOperator>) { return binaryOperator<ModulusOperator>(std::move(*this),rhs); }
+    BasicGeneralType operator%(BasicGeneralType && rhs) const & requires(declaresBinary<ModulusOperator>) { return binaryOperator<ModulusOperator>(*this,std::move(rhs)); }
+    BasicGeneralType operator%(BasicGeneralType && rhs) && requires(declaresBinary<ModulusOperator>) { return binaryOperator<ModulusOperator>(std::move(*this),std::move(rhs)); }
+
+    //! Bitwise AND operator, forwards to the bitwise AND operator of the held types
+    BasicGeneralType operator&(const BasicGeneralType & rhs) const & requires(declaresBinary<BitwiseAndOperator>) { return binaryOperator<BitwiseAndOperator>(*this,rhs); }
+    BasicGeneralType operator&(const BasicGeneralType & rhs) && requires(declaresBinary<BitwiseAndOperator>) { return binaryOperator<BitwiseAndOperator>(std::move(*this),rhs); }
+    BasicGeneralType operator&(BasicGeneralType && rhs) const & requires(declaresBinary<BitwiseAndOperator>) { return binaryOperator<BitwiseAndOperator>(*this,std::move(rhs)); }
+    BasicGeneralType operator&(BasicGeneralType && rhs) && requires(declaresBinary<BitwiseAndOperator>) { return binaryOperator<BitwiseAndOperator>(std::move(*this),std::move(rhs)); }
+
+    //! Logical AND operator, forwards to the logical AND operator of the held types
+    BasicGeneralType operator&&(const BasicGeneralType & rhs) const & requires(declaresBinary<LogicalAndOperator>) { return binaryOperator<LogicalAndOperator>(*this,rhs); }
+    BasicGeneralType operator&&(const BasicGeneralType & rhs) && requires(declaresBinary<LogicalAndOperator>) { return binaryOperator<LogicalAndOperator>(std::move(*this),rhs); }
+    BasicGeneralType operator&&(BasicGeneralType && rhs) const & requires(declaresBinary<LogicalAndOperator>) { return binaryOperator<LogicalAndOperator>(*this,std::move(rhs)); }
+    BasicGeneralType operator&&(BasicGeneralType && rhs) && requires(declaresBinary<LogicalAndOperator>) { return binaryOperator<LogicalAndOperator>(std::move(*this),std::move(rhs)); }
+
+    //! Exclusive Or operator, forwards to the exclusive or operator of the held types
+    BasicGeneralType operator^(const BasicGeneralType & rhs) const & requires(declaresBinary<ExclusiveOrOperator>) { return binaryOperator<ExclusiveOrOperator>(*this,rhs); }
+    BasicGeneralType operator^(const BasicGeneralType & rhs) && requires(declaresBinary<ExclusiveOrOperator>) { return binaryOperator<ExclusiveOrOperator>(std::move(*this),rhs); }
+    BasicGeneralType operator^(BasicGeneralType && rhs) const & requires(declaresBinary<ExclusiveOrOperator>) { return binaryOperator<ExclusiveOrOperator>(*this,std::move(rhs)); }
+    BasicGeneralType operator^(BasicGeneralType && rhs) && requires(declaresBinary<ExclusiveOrOperator>) { return binaryOperator<ExclusiveOrOperator>(std::move(*this),std::move(rhs)); }
+
+    //! Bitwise inclusive Or operator, forwards to the bitwise inclusive or operator of the held types
+    BasicGeneralType operator|(const BasicGeneralType & rhs) const & requires(declaresBinary<BitwiseInclusiveOrOperator>) { return binaryOperator<BitwiseInclusiveOrOperator>(*this,rhs); }
+    BasicGeneralType operator|(const BasicGeneralType & rhs) && requires(declaresBinary<BitwiseInclusiveOrOperator>) { return binaryOperator<BitwiseInclusiveOrOperator>(std::move(*this),rhs); }
+    BasicGeneralType operator|(BasicGeneralType && rhs) const & requires(declaresBinary<BitwiseInclusiveOrOperator>) { return binaryOperator<BitwiseInclusiveOrOperator>(*this,std::move(rhs)); }
+    BasicGeneralType operator|(BasicGeneralType && rhs) && requires(declaresBinary<BitwiseInclusiveOrOperator>) { return binaryOperator<BitwiseInclusiveOrOperator>(std::move(*this),std::move(rhs)); }
+
+    //! Logical inclusive Or operator, forwards to the logical inclusive or operator of the held types
+    BasicGeneralType operator||(const BasicGeneralType & rhs) const & requires(declaresBinary<LogicalInclusiveOrOperator>) { return binaryOperator<LogicalInclusiveOrOperator>(*this,rhs); }
+    BasicGeneralType operator||(const BasicGeneralType & rhs) && requires(declaresBinary<LogicalInclusiveOrOperator>) { return binaryOperator<LogicalInclusiveOrOperator>(std::move(*this),rhs); }
+    BasicGeneralType operator||(BasicGeneralType && rhs) const & requires(declaresBinary<LogicalInclusiveOrOperator>) { return binaryOperator<LogicalInclusiveOrOperator>(*this,std::move(rhs)); }
+    BasicGeneralType operator||(BasicGeneralType && rhs) && requires(declaresBinary<LogicalInclusiveOrOperator>) { return binaryOperator<LogicalInclusiveOrOperator>(std::move(*this),std::move(rhs)); }
+
+    //! Comparison smaller operator, forwards to the smaller comparison operator of the held types
+    BasicGeneralType operator<(const BasicGeneralType & rhs) const & requires(declaresBinary<SmallerComparisonOperator>) { return binaryOperator<SmallerComparisonOperator>(*this,rhs); }
+    BasicGeneralType operator<(const BasicGeneralType & rhs) && requires(declaresBinary<SmallerComparisonOperator>) { return binaryOperator<SmallerComparisonOperator>(std::move(*this),rhs); }
+    BasicGeneralType operator<(BasicGeneralType && rhs) const & requires(declaresBinary<SmallerComparisonOperator>) { return binaryOperator<SmallerComparisonOperator>(*this,std::move(rhs)); }
+    BasicGeneralType operator<(BasicGeneralType && rhs) && requires(declaresBinary<SmallerComparisonOperator>) { return binaryOperator<SmallerComparisonOperator>(std::move(*this),std::move(rhs)); }
+
+    //! Comparison larger operator, forwards to the larger comparison operator of the held types
+    BasicGeneralType operator>(const BasicGeneralType & rhs) const & requires(declaresBinary<LargerComparisonOperator>) { return binaryOperator<LargerComparisonOperator>(*this,rhs); }
+    BasicGeneralType operator>(const BasicGeneralType & rhs) && requires(declaresBinary<LargerComparisonOperator>) { return binaryOperator<LargerComparisonOperator>(std::move(*this),rhs); }
+    BasicGeneralType operator>(BasicGeneralType && rhs) const & requires(declaresBinary<LargerComparisonOperator>) { return binaryOperator<LargerComparisonOperator>(*this,std::move(rhs)); }
+    BasicGeneralType operator>(BasicGeneralType && rhs) && requires(declaresBinary<LargerComparisonOperator>) { return binaryOperator<LargerComparisonOperator>(std::move(*this),std::move(rhs)); }
+
+    //! Comparison smaller equal operator, forwards to the smaller equal comparison operator of the held types
+    BasicGeneralType operator<=(const BasicGeneralType & rhs) const & requires(declaresBinary<SmallerEqualComparisonOperator>) { return binaryOperator<SmallerEqualComparisonOperator>(*this,rhs); }
+    BasicGeneralType operator<=(const BasicGeneralType & rhs) && requires(declaresBinary<SmallerEqualComparisonOperator>) { return binaryOperator<SmallerEqualComparisonOperator>(std::move(*this),rhs); }
+    BasicGeneralType operator<=(BasicGeneralType && rhs) const & requires(declaresBinary<SmallerEqualComparisonOperator>) { return binaryOperator<SmallerEqualComparisonOperator>(*this,std::move(rhs)); }
+    BasicGeneralType operator<=(BasicGeneralType && rhs) && requires(declaresBinary<SmallerEqualComparisonOperator>) { return binaryOperator<SmallerEqualComparisonOperator>(std::move(*this),std::move(rhs)); }
+
+    //! Comparison larger equal operator, forwards to the larger equal comparison operator of the held types
+    BasicGeneralType operator>=(const BasicGeneralType & rhs) const & requires(declaresBinary<LargerEqualComparisonOperator>) { return binaryOperator<LargerEqualComparisonOperator>(*this,rhs); }
+    BasicGeneralType operator>=(const BasicGeneralType & rhs) && requires(declaresBinary<LargerEqualComparisonOperator>) { return binaryOperator<LargerEqualComparisonOperator>(std::move(*this),rhs); }
+    BasicGeneralType operator>=(BasicGeneralType && rhs) const & requires(declaresBinary<LargerEqualComparisonOperator>) { return binaryOperator<LargerEqualComparisonOperator>(*this,std::move(rhs)); }
+    BasicGeneralType operator>=(BasicGeneralType && rhs) && requires(declaresBinary<LargerEqualComparisonOperator>) { return binaryOperator<LargerEqualComparisonOperator>(std::move(*this),std::move(rhs)); }
+
+    //! Comparison Equality operator, forwards to the equality comparison operator of the held types
+    BasicGeneralType operator==(const BasicGeneralType & rhs) const & requires(declaresBinary<EqualityComparisonOperator>) { return binaryOperator<EqualityComparisonOperator>(*this,rhs); }
+    BasicGeneralType operator==(const BasicGeneralType & rhs) && requires(declaresBinary<EqualityComparisonOperator>) { return binaryOperator<EqualityComparisonOperator>(std::move(*this),rhs); }
+    BasicGeneralType operator==(BasicGeneralType && rhs) const & requires(declaresBinary<EqualityComparisonOperator>) { return binaryOperator<EqualityComparisonOperator>(*this,std::move(rhs)); }
+    BasicGeneralType operator==(BasicGeneralType && rhs) && requires(declaresBinary<EqualityComparisonOperator>) { return binaryOperator<EqualityComparisonOperator>(std::move(*this),std::move(rhs)); }
+
+    //! Comparison Inequality operator, forwards to the inequality comparison operator of the held types
+    BasicGeneralType operator!=(const BasicGeneralType & rhs) const & requires(declaresBinary<InequalityComparisonOperator>) { return binaryOperator<InequalityComparisonOperator>(*this,rhs); }
+    BasicGeneralType operator!=(const BasicGeneralType & rhs) && requires(declaresBinary<InequalityComparisonOperator>) { return binaryOperator<InequalityComparisonOperator>(std::move(*this),rhs); }
+    BasicGeneralType operator!=(BasicGeneralType && rhs) const & requires(declaresBinary<InequalityComparisonOperator>) { return binaryOperator<InequalityComparisonOperator>(*this,std::move(rhs)); }
+    BasicGeneralType operator!=(BasicGeneralType && rhs) && requires(declaresBinary<InequalityComparisonOperator>) { return binaryOperator<InequalityComparisonOperator>(std::move(*this),std::move(rhs)); }
+
+    //! Addition assignment operator, forwards to the addition assignment operator of the held types
+    BasicGeneralType & operator+=(const BasicGeneralType & rhs) requires(declaresAssignment<AddAssignmentOperator>) { return assignmentOperator<AddAssignmentOperator>(rhs); }
+    BasicGeneralType & operator+=(BasicGeneralType && rhs) requires(declaresAssignment<AddAssignmentOperator>) { return assignmentOperator<AddAssignmentOperator>(std::move(rhs)); }
+
+    //! Subtraction assignment operator, forwards to the subtraction assignment operator of the held types
+    BasicGeneralType & operator-=(const BasicGeneralType & rhs) requires(declaresAssignment<SubtractAssignmentOperator>) { return assignmentOperator<SubtractAssignmentOperator>(rhs); }
+    BasicGeneralType & operator-=(BasicGeneralType && rhs) requires(declaresAssignment<SubtractAssignmentOperator>) { return assignmentOperator<SubtractAssignmentOperator>(std::move(rhs)); }
+
+    //! Multiplication assignment operator, forwards to the multiplication assignment operator of the held types
+    BasicGeneralType & operator*=(const BasicGeneralType & rhs) requires(declaresAssignment<MultiplyAssignmentOperator>) { return assignmentOperator<MultiplyAssignmentOperator>(rhs); }
+    BasicGeneralType & operator*=(BasicGeneralType && rhs) requires(declaresAssignment<MultiplyAssignmentOperator>) { return assignmentOperator<MultiplyAssignmentOperator>(std::move(rhs)); }
+
+    //! Division assignment operator, forwards to the division assignment operator of the held types
+    BasicGeneralType & operator/=(const BasicGeneralType & rhs) requires(declaresAssignment<DivisionAssignmentOperator>) { return assignmentOperator<DivisionAssignmentOperator>(rhs); }
+    BasicGeneralType & operator/=(BasicGeneralType && rhs) requires(declaresAssignment<DivisionAssignmentOperator>) { return assignmentOperator<DivisionAssignmentOperator>(std::move(rhs)); }
+
+    //! Modulus assignment operator, forwards to the modulus assignment operator of the held types
+    BasicGeneralType & operator%=(const BasicGeneralType & rhs) requires(declaresAssignment<ModulusAssignmentOperator>) { return assignmentOperator<ModulusAssignmentOperator>(rhs); }
+    BasicGeneralType & operator%=(BasicGeneralType && rhs) requires(declaresAssignment<ModulusAssignmentOperator>) { return assignmentOperator<ModulusAssignmentOperator>(std::move(rhs)); }
+
+    //! Bitwise AND assignment operator, forwards to the bitwise AND assignment operator of the held types
+    BasicGeneralType & operator&=(const BasicGeneralType & rhs) requires(declaresAssignment<BitwiseAndAssignmentOperator>) { return assignmentOperator<BitwiseAndAssignmentOperator>(rhs); }
+    BasicGeneralType & operator&=(BasicGeneralType && rhs) requires(declaresAssignment<BitwiseAndAssignmentOperator>) { return assignmentOperator<BitwiseAndAssignmentOperator>(std::move(rhs)); }
+
+    //! Bitwise Inclusive OR assignment operator, forwards to the bitwise inclusive or assignment operator of the held types
+    BasicGeneralType & operator|=(const BasicGeneralType & rhs) requires(declaresAssignment<BitwiseInclusiveOrAssignmentOperator>) { return assignmentOperator<BitwiseInclusiveOrAssignmentOperator>(rhs); }
+    BasicGeneralType & operator|=(BasicGeneralType && rhs) requires(declaresAssignment<BitwiseInclusiveOrAssignmentOperator>) { return assignmentOperator<BitwiseInclusiveOrAssignmentOperator>(std::move(rhs)); }
+
+    //! Exclusive OR assignment operator, forwards to the exclusive or assignment operator of the held types
+    BasicGeneralType & operator^=(const BasicGeneralType & rhs) requires(declaresAssignment<ExclusiveOrAssignmentOperator>) { return assignmentOperator<ExclusiveOrAssignmentOperator>(rhs); }
+    BasicGeneralType & operator^=(BasicGeneralType && rhs) requires(declaresAssignment<ExclusiveOrAssignmentOperator>) { return assignmentOperator<ExclusiveOrAssignmentOperator>(std::move(rhs)); }
+
+    //! Right shift assignment operator, forwards to the right shift assignment operator of the held types
+    BasicGeneralType & operator>>=(const BasicGeneralType & rhs) requires(declaresAssignment<RightShiftAssignmentOperator>) { return assignmentOperator<RightShiftAssignmentOperator>(rhs); }
+    BasicGeneralType & operator>>=(BasicGeneralType && rhs) requires(declaresAssignment<RightShiftAssignmentOperator>) { return assignmentOperator<RightShiftAssignmentOperator>(std::move(rhs)); }
+
+    //! Left shift assignment operator, forwards to the left shift assignment operator of the held types
+    BasicGeneralType & operator<<=(const BasicGeneralType & rhs) requires(declaresAssignment<LeftShiftAssignmentOperator>) { return assignmentOperator<LeftShiftAssignmentOperator>(rhs); }
+    BasicGeneralType & operator<<=(BasicGeneralType && rhs) requires(declaresAssignment<LeftShiftAssignmentOperator>) { return assignmentOperator<LeftShiftAssignmentOperator>(std::move(rhs)); }
 
+    // =========================================================================================
+    // External Operators
+    // =========================================================================================
     
-    //! Addition operator, forwards to the addition operator of the held type
-    GeneralType<Types_...> operator+(GeneralType<Types_...> rhs){
-        return std::visit(
-            [&rhs](auto & lhs_arg){
-                return std::visit(
-                    [&lhs_arg] (auto & rhs_arg){
-                        if constexpr ( areAddable<decltype(lhs_arg),decltype(rhs_arg)> ){
-                            return GeneralType<Types_...>(lhs_arg + rhs_arg);
-                        } else {
-                            throw std::runtime_error(
-                                "Can not invoke operator+ on held types (" 
-                                + typeToString<decltype(lhs_arg)>() + " and " 
-                                + typeToString<decltype(rhs_arg)>() + ")"
-                            );
-                            return GeneralType<Types_...>(lhs_arg);
-                        }
-                    },
-                    rhs.obj_
-                );
-            },
-            this->obj_
-        );
+    //! A function, that checks if `Type` is held by provided GeneralType
+    template<typename Type>
+    friend constexpr bool holdsType( const BasicGeneralType & gt ){
+        if constexpr( (std::is_same_v<Type,Types_> || ... ) ){
+            return std::holds_alternative<Type>(gt.obj_);
+        } else {
+            return false;
+        }
     }
 
-    //! Subtraction operator, forwards to the addition operator of the held type
-    GeneralType<Types_...> operator-(GeneralType<Types_...> rhs){
-        return std::visit(
-            [&rhs](auto & lhs_arg){
-                return std::visit(
-                    [&lhs_arg] (auto & rhs_arg){
-                        if constexpr ( areSubtractable<decltype(lhs_arg),decltype(rhs_arg)> ){
-                            // This operation somehow requires long int in the std::variant
-                            // I don't understand why, but I added it as a fix as default 
-                            // to the obj_
-                            return GeneralType<Types_...>( 
-                                lhs_arg - rhs_arg
-                            );
-                        } else {
-                            throw std::runtime_error(
-                                "Can not invoke operator- on held types (" 
-                                + typeToString<decltype(lhs_arg)>() + " and " 
-                                + typeToString<decltype(rhs_arg)>() + ")"
-                            );
-                            return GeneralType<Types_...>(lhs_arg);
-                        }
-                    },
-                    rhs.obj_
-                );
-            },
-            this->obj_
-        );
+    // The operators with a non-GeneralType on the left hand side are only available if that type 
+    // is one of the types of the GeneralType
+
+    //! Addition operator with non-GeneralType, forwards to the addition operator of the held type
+    template<typename Type>
+        requires((std::is_same_v<Type,Types_> || ... ) && declaresMixed<AdditionOperator,Type>)
+    friend BasicGeneralType operator+(const Type & LHS, const BasicGeneralType & RHS ){
+        return mixedOperator<AdditionOperator,BasicGeneralType>(LHS,RHS);
     }
 
-    //! Multiplication operator, forwards to the addition operator of the held type
-    GeneralType<Types_...> operator*(GeneralType<Types_...> rhs){
-        return std::visit(
-            [&rhs](auto & lhs_arg){
-                return std::visit(
-                    [&lhs_arg] (auto & rhs_arg){
-                        if constexpr ( areMultipliable<decltype(lhs_arg),decltype(rhs_arg)> ){
-                            return GeneralType<Types_...>(lhs_arg * rhs_arg);
-                        } else {
-                            throw std::runtime_error(
-                                "Can not invoke operator* on held types (" 
-                                + typeToString<decltype(lhs_arg)>() + " and " 
-                                + typeToString<decltype(rhs_arg)>() + ")"
-                            );
-                            return GeneralType<Types_...>(lhs_arg);
-                        }
-                    },
-                    rhs.obj_
-                );
-            },
-            this->obj_
-        );
+    //! Subtraction operator with non-GeneralType, forwards to the subtraction operator of the held type
+    template<typename Type>
+        requires((std::is_same_v<Type,Types_> || ... ) && declaresMixed<SubtractionOperator,Type>)
+    friend BasicGeneralType operator-(const Type & LHS, const BasicGeneralType & RHS ){
+        return mixedOperator<SubtractionOperator,BasicGeneralType>(LHS,RHS);
     }
 
-    //! Division operator, forwards to the addition operator of the held type
-    GeneralType<Types_...> operator/(GeneralType<Types_...> rhs){
-        return std::visit(
-            [&rhs](auto & lhs_arg){
-                return std::visit(
-                    [&lhs_arg] (auto & rhs_arg){
-                        if constexpr ( areDivisible<decltype(lhs_arg),decltype(rhs_arg)> ){
-                            return GeneralType<Types_...>(lhs_arg / rhs_arg);
-                        } else {
-                            throw std::runtime_error(
-                                "Can not invoke operator/ on held types (" 
-                                + typeToString<decltype(lhs_arg)>() + " and " 
-                                + typeToString<decltype(rhs_arg)>() + ")"
-                            );
-                            return GeneralType<Types_...>(lhs_arg);
-                        }
-                    },
-                    rhs.obj_
-                );
-            },
-            this->obj_
-        );
+    //! Multiplication operator with non-GeneralType, forwards to the multiplication operator of the held type
+    template<typename Type>
+        requires((std::is_same_v<Type,Types_> || ... ) && declaresMixed<MultiplicationOperator,Type>)
+    friend BasicGeneralType operator*(const Type & LHS, const BasicGeneralType & RHS ){
+        return mixedOperator<MultiplicationOperator,BasicGeneralType>(LHS,RHS);
     }
 
-    //! Modulus operator, forwards to the addition operator of the held type
-    GeneralType<Types_...> operator%(GeneralType<Types_...> rhs){
-        return std::visit(
-            [&rhs](auto & lhs_arg){
-                return std::visit(
-                    [&lhs_arg] (auto & rhs_arg){
-                        if constexpr ( areModulus<decltype(lhs_arg),decltype(rhs_arg)> ){
-                            return GeneralType<Types_...>(lhs_arg % rhs_arg);
-                        } else {
-                            throw std::runtime_error(
-                                "Can not invoke operator% on held types (" 
-                                + typeToString<decltype(lhs_arg)>() + " and " 
-                                + typeToString<decltype(rhs_arg)>() + ")"
-                            );
-                            return GeneralType<Types_...>(lhs_arg);
-                        }
-                    },
-                    rhs.obj_
-                );
-            },
-            this->obj_
-        );
+    //! Division operator with non-GeneralType, forwards to the division operator of the held type
+    template<typename Type>
+        requires((std::is_same_v<Type,Types_> || ... ) && declaresMixed<DivisionOperator,Type>)
+    friend BasicGeneralType operator/(const Type & LHS, const BasicGeneralType & RHS ){
+        return mixedOperator<DivisionOperator,BasicGeneralType>(LHS,RHS);
     }
 
-    //! Bitwise AND operator, forwards to the addition operator of the held type
-    GeneralType<Types_...> operator&(GeneralType<Types_...> rhs){
-        return std::visit(
-            [&rhs](auto & lhs_arg){
-                return std::visit(
-                    [&lhs_arg] (auto & rhs_arg){
-                        if constexpr ( areBitwiseAndable<decltype(lhs_arg),decltype(rhs_arg)> ){
-                            return GeneralType<Types_...>(lhs_arg & rhs_arg);
-                        } else {
-                            throw std::runtime_error(
-                                "Can not invoke operator& on held types (" 
-                                + typeToString<decltype(lhs_arg)>() + " and " 
-                                + typeToString<decltype(rhs_arg)>() + ")"
-                            );
-                            return GeneralType<Types_...>(lhs_arg);
-                        }
-                    },
-                    rhs.obj_
-                );
-            },
-            this->obj_
-        );
+    //! Modulus operator with non-GeneralType, forwards to the modulus operator of the held type
+    template<typename Type>
+        requires((std::is_same_v<Type,Types_> || ... ) && declaresMixed<ModulusOperator,Type>)
+    friend BasicGeneralType operator%(const Type & LHS, const BasicGeneralType & RHS ){
+        return mixedOperator<ModulusOperator,BasicGeneralType>(LHS,RHS);
     }
 
-    //! Logical AND operator, forwards to the addition operator of the held type
-    GeneralType<Types_...> operator&&(GeneralType<Types_...> rhs){
-        return std::visit(
-            [&rhs](auto & lhs_arg){
-                return std::visit(
-                    [&lhs_arg] (auto & rhs_arg){
-                        if constexpr ( areLogicalAndable<decltype(lhs_arg),decltype(rhs_arg)> ){
-                            return GeneralType<Types_...>(lhs_arg && rhs_arg);
-                        } else {
-                            throw std::runtime_error(
-                                "Can not invoke operator&& on held types (" 
-                                + typeToString<decltype(lhs_arg)>() + " and " 
-                                + typeToString<decltype(rhs_arg)>() + ")"
-                            );
-                            return GeneralType<Types_...>(lhs_arg);
-                        }
-                    },
-                    rhs.obj_
-                );
-            },
-            this->obj_
-        );
+    //! Bitwise AND operator with non-GeneralType, forwards to the bitwise AND operator of the held type
+    template<typename Type>
+        requires((std::is_same_v<Type,Types_> || ... ) && declaresMixed<BitwiseAndOperator,Type>)
+    friend BasicGeneralType operator&(const Type & LHS, const BasicGeneralType & RHS ){
+        return mixedOperator<BitwiseAndOperator,BasicGeneralType>(LHS,RHS);
     }
 
-    //! Exclusive Or operator, forwards to the addition operator of the held type
-    GeneralType<Types_...> operator^(GeneralType<Types_...> rhs){
-        return std::visit(
-            [&rhs](auto & lhs_arg){
-                return std::visit(
-                    [&lhs_arg] (auto & rhs_arg){
-                        if constexpr ( areExclusiveOrable<decltype(lhs_arg),decltype(rhs_arg)> ){
-                            return GeneralType<Types_...>(lhs_arg ^ rhs_arg);
-                        } else {
-                            throw std::runtime_error(
-                                "Can not invoke operator^ on held types (" 
-                                + typeToString<decltype(lhs_arg)>() + " and " 
-                                + typeToString<decltype(rhs_arg)>() + ")"
-                            );
-                            return GeneralType<Types_...>(lhs_arg);
-                        }
-                    },
-                    rhs.obj_
-                );
-            },
-            this->obj_
-        );
+    //! Logical AND operator with non-GeneralType, forwards to the logical AND operator of the held type
+    template<typename Type>
+        requires((std::is_same_v<Type,Types_> || ... ) && declaresMixed<LogicalAndOperator,Type>)
+    friend BasicGeneralType operator&&(const Type & LHS, const BasicGeneralType & RHS ){
+        return mixedOperator<LogicalAndOperator,BasicGeneralType>(LHS,RHS);
     }
 
-    //! Bitwise inclusive Or operator, forwards to the addition operator of the held type
-    GeneralType<Types_...> operator|(GeneralType<Types_...> rhs){
-        return std::visit(
-            [&rhs](auto & lhs_arg){
-                return std::visit(
-                    [&lhs_arg] (auto & rhs_arg){
-                        if constexpr ( areExclusiveOrable<decltype(lhs_arg),decltype(rhs_arg)> ){
-                            return GeneralType<Types_...>(lhs_arg | rhs_arg);
-                        } else {
-                            throw std::runtime_error(
-                                "Can not invoke operator| on held types (" 
-                                + typeToString<decltype(lhs_arg)>() + " and " 
-                                + typeToString<decltype(rhs_arg)>() + ")"
-                            );
-                            return GeneralType<Types_...>(lhs_arg);
-                        }
-                    },
-                    rhs.obj_
-                );
-            },
-            this->obj_
-        );
+    //! Bitwise inclusive OR operator with non-GeneralType, forwards to the bitwise inclusive OR operator of the held type
+    template<typename Type>
+        requires((std::is_same_v<Type,Types_> || ... ) && declaresMixed<BitwiseInclusiveOrOperator,Type>)
+    friend BasicGeneralType operator|(const Type & LHS, const BasicGeneralType & RHS ){
+        return mixedOperator<BitwiseInclusiveOrOperator,BasicGeneralType>(LHS,RHS);
     }
 
-    //! Logical inclusive Or operator, forwards to the addition operator of the held type
-    GeneralType<Types_...> operator||(GeneralType<Types_...> rhs){
-        return std::visit(
-            [&rhs](auto & lhs_arg){
-                return std::visit(
-                    [&lhs_arg] (auto & rhs_arg){
-                        if constexpr ( areLogicalInclusiveOrable<decltype(lhs_arg),decltype(rhs_arg)> ){
-                            return GeneralType<Types_...>(lhs_arg || rhs_arg);
-                        } else {
-                            throw std::runtime_error(
-                                "Can not invoke operator|| on held types (" 
-                                + typeToString<decltype(lhs_arg)>() + " and " 
-                                + typeToString<decltype(rhs_arg)>() + ")"
-                            );
-                            return GeneralType<Types_...>(lhs_arg);
-                        }
-                    },
-                    rhs.obj_
-                );
-            },
-            this->obj_
-        );
+    //! Exclusive OR operator with non-GeneralType, forwards to the exclusive OR operator of the held type
+    template<typename Type>
+        requires((std::is_same_v<Type,Types_> || ... ) && declaresMixed<ExclusiveOrOperator,Type>)
+    friend BasicGeneralType operator^(const Type & LHS, const BasicGeneralType & RHS ){
+        return mixedOperator<ExclusiveOrOperator,BasicGeneralType>(LHS,RHS);
     }
 
-    //! Comparison smaller operator, forwards to the addition operator of the held type
-    GeneralType<Types_...> operator<(GeneralType<Types_...> rhs){
-        return std::visit(
-            [&rhs](auto & lhs_arg){
-                return std::visit(
-                    [&lhs_arg] (auto & rhs_arg){
-                        if constexpr ( areSmallerComparable<decltype(lhs_arg),decltype(rhs_arg)> ){
-                            return GeneralType<Types_...>(lhs_arg < rhs_arg);
-                        } else {
-                            throw std::runtime_error(
-                                "Can not invoke operator< on held types (" 
-                                + typeToString<decltype(lhs_arg)>() + " and " 
-                                + typeToString<decltype(rhs_arg)>() + ")"
-                            );
-                            return GeneralType<Types_...>(lhs_arg);
-                        }
-                    },
-                    rhs.obj_
-                );
-            },
-            this->obj_
-        );
+    //! Logical inclusive OR operator with non-GeneralType, forwards to the logical inclusive OR operator of the held type
+    template<typename Type>
+        requires((std::is_same_v<Type,Types_> || ... ) && declaresMixed<LogicalInclusiveOrOperator,Type>)
+    friend BasicGeneralType operator||(const Type & LHS, const BasicGeneralType & RHS ){
+        return mixedOperator<LogicalInclusiveOrOperator,BasicGeneralType>(LHS,RHS);
     }
 
-    //! Comparison larger operator, forwards to the addition operator of the held type
-    GeneralType<Types_...> operator>(GeneralType<Types_...> rhs){
-        return std::visit(
-            [&rhs](auto & lhs_arg){
-                return std::visit(
-                    [&lhs_arg] (auto & rhs_arg){
-                        if constexpr ( areLargerComparable<decltype(lhs_arg),decltype(rhs_arg)> ){
-                            return GeneralType<Types_...>(lhs_arg > rhs_arg);
-                        } else {
-                            throw std::runtime_error(
-                                "Can not invoke operator> on held types (" 
-                                + typeToString<decltype(lhs_arg)>() + " and " 
-                                + typeToString<decltype(rhs_arg)>() + ")"
-                            );
-                            return GeneralType<Types_...>(lhs_arg);
-                        }
-                    },
-                    rhs.obj_
-                );
-            },
-            this->obj_
-        );
+    //! Smaller operator with non-GeneralType, forwards to the smaller comparison operator of the held type
+    template<typename Type>
+        requires((std::is_same_v<Type,Types_> || ... ) && declaresMixed<SmallerComparisonOperator,Type>)
+    friend BasicGeneralType operator<(const Type & LHS, const BasicGeneralType & RHS ){
+        return mixedOperator<SmallerComparisonOperator,BasicGeneralType>(LHS,RHS);
     }
 
-    //! Comparison smaller equal operator, forwards to the addition operator of the held type
-    GeneralType<Types_...> operator<=(GeneralType<Types_...> rhs){
-        return std::visit(
-            [&rhs](auto & lhs_arg){
-                return std::visit(
-                    [&lhs_arg] (auto & rhs_arg){
-                        if constexpr ( areSmallerEqualComparable<decltype(lhs_arg),decltype(rhs_arg)> ){
-                            return GeneralType<Types_...>(lhs_arg <= rhs_arg);
-                        } else {
-                            throw std::runtime_error(
-                                "Can not invoke operator<= on held types (" 
-                                + typeToString<decltype(lhs_arg)>() + " and " 
-                                + typeToString<decltype(rhs_arg)>() + ")"
-                            );
-                            return GeneralType<Types_...>(lhs_arg);
-                        }
-                    },
-                    rhs.obj_
-                );
-            },
-            this->obj_
-        );
+    //! Larger operator with non-GeneralType, forwards to the larger comparison operator of the held type
+    template<typename Type>
+        requires((std::is_same_v<Type,Types_> || ... ) && declaresMixed<LargerComparisonOperator,Type>)
+    friend BasicGeneralType operator>(const Type & LHS, const BasicGeneralType & RHS ){
+        return mixedOperator<LargerComparisonOperator,BasicGeneralType>(LHS,RHS);
     }
 
-    //! Comparison larger equal operator, forwards to the addition operator of the held type
-    GeneralType<Types_...> operator>=(GeneralType<Types_...> rhs){
-        return std::visit(
-            [&rhs](auto & lhs_arg){
-                return std::visit(
-                    [&lhs_arg] (auto & rhs_arg){
-                        if constexpr ( areLargerEqualComparable<decltype(lhs_arg),decltype(rhs_arg)> ){
-                            return GeneralType<Types_...>(lhs_arg >= rhs_arg);
-                        } else {
-                            throw std::runtime_error(
-                                "Can not invoke operator>= on held types (" 
-                                + typeToString<decltype(lhs_arg)>() + " and " 
-                                + typeToString<decltype(rhs_arg)>() + ")"
-                            );
-                            return GeneralType<Types_...>(lhs_arg);
-                        }
-                    },
-                    rhs.obj_
-                );
-            },
-            this->obj_
-        );
+    //! Smaller-Equal operator with non-GeneralType, forwards to the smaller equal comparison operator of the held type
+    template<typename Type>
+        requires((std::is_same_v<Type,Types_> || ... ) && declaresMixed<SmallerEqualComparisonOperator,Type>)
+    friend BasicGeneralType operator<=(const Type & LHS, const BasicGeneralType & RHS ){
+        return mixedOperator<SmallerEqualComparisonOperator,BasicGeneralType>(LHS,RHS);
     }
 
-    //! Comparison Equality operator, forwards to the addition operator of the held type
-    GeneralType<Types_...> operator==(GeneralType<Types_...> rhs){
-        return std::visit(
-            [&rhs](auto & lhs_arg){
-                return std::visit(
-                    [&lhs_arg] (auto & rhs_arg){
-                        if constexpr ( areEqualityComparable<decltype(lhs_arg),decltype(rhs_arg)> ){
-                            return GeneralType<Types_...>(lhs_arg == rhs_arg);
-                        } else {
-                            throw std::runtime_error(
-                                "Can not invoke operator== on held types (" 
-                                + typeToString<decltype(lhs_arg)>() + " and " 
-                                + typeToString<decltype(rhs_arg)>() + ")"
-                            );
-                            return GeneralType<Types_...>(lhs_arg);
-                        }
-                    },
-                    rhs.obj_
-                );
-            },
-            this->obj_
-        );
+    //! Larger-Equal operator with non-GeneralType, forwards to the larger equal comparison operator of the held type
+    template<typename Type>
+        requires((std::is_same_v<Type,Types_> || ... ) && declaresMixed<LargerEqualComparisonOperator,Type>)
+    friend BasicGeneralType operator>=(const Type & LHS, const BasicGeneralType & RHS ){
+        return mixedOperator<LargerEqualComparisonOperator,BasicGeneralType>(LHS,RHS);
     }
 
-    //! Comparison Inequality operator, forwards to the addition operator of the held type
-    GeneralType<Types_...> operator!=(GeneralType<Types_...> rhs){
-        return std::visit(
-            [&rhs](auto & lhs_arg){
-                return std::visit(
-                    [&lhs_arg] (auto & rhs_arg){
-                        if constexpr ( areInequalityComparable<decltype(lhs_arg),decltype(rhs_arg)> ){
-                            return GeneralType<Types_...>(lhs_arg != rhs_arg);
-                        } else {
-                            throw std::runtime_error(
-                                "Can not invoke operator=! on held types (" 
-                                + typeToString<decltype(lhs_arg)>() + " and " 
-                                + typeToString<decltype(rhs_arg)>() + ")"
-                            );
-                            return GeneralType<Types_...>(lhs_arg);
-                        }
-                    },
-                    rhs.obj_
-                );
-            },
-            this->obj_
-        );
+    //! Equality operator with non-GeneralType, forwards to the equality comparison operator of the held type
+    template<typename Type>
+        requires((std::is_same_v<Type,Types_> || ... ) && declaresMixed<EqualityComparisonOperator,Type>)
+    friend bool operator==(const Type & LHS, const BasicGeneralType & RHS ){
+        return mixedOperator<EqualityComparisonOperator,bool>(LHS,RHS);
     }
 
-    //! Addition assignment operator, forwards to the addition operator of the held type
-    GeneralType<Types_...> operator+=(GeneralType<Types_...> rhs){
-        std::visit(
-            [&rhs](auto & lhs_arg){
-                return std::visit(
-                    [&lhs_arg] (auto & rhs_arg){
-                        if constexpr ( areAddAssignable<decltype(lhs_arg),decltype(rhs_arg)> ){
-                            lhs_arg += rhs_arg;
-                        } else {
-                            throw std::runtime_error(
-                                "Can not invoke operator+= on held types (" 
-                                + typeToString<decltype(lhs_arg)>() + " and " 
-                                + typeToString<decltype(rhs_arg)>() + ")"
-                            );
-                        }
-                    },
-                    rhs.obj_
-                );
-            },
-            this->obj_
-        );
+    //! Inequality operator with non-GeneralType, forwards to the inequality comparison operator of the held type
+    template<typename Type>
+        requires((std::is_same_v<Type,Types_> || ... ) && declaresMixed<InequalityComparisonOperator,Type>)
+    friend bool operator!=(const Type & LHS, const BasicGeneralType & RHS ){
+        return mixedOperator<InequalityComparisonOperator,bool>(LHS,RHS);
+    }
 
-        return *this;
+    // =========================================================================================
+    // Bulk Operators
+    // =========================================================================================
+
+    // The bulk operators apply an operator element wise to spans of GeneralTypes, e.g. 
+    // `add(lhs,rhs,result)` computes `result[i] = lhs[i] + rhs[i]`. Instead of dispatching every element
+    // on its own, the elements are grouped by the pair of held alternatives and every group is processed 
+    // in one tight loop. As hidden friends they are found for `std::vector`s of GeneralTypes, too. 
+    // `result` may be the same span as `lhs` or `rhs`.
+
+    //! Element wise addition of `lhs` and `rhs`, stored in `result`
+    friend void add(
+        std::span<const BasicGeneralType> lhs, std::span<const BasicGeneralType> rhs, std::span<BasicGeneralType> result
+    ) requires(declaresBinary<AdditionOperator>) { bulkOperator<AdditionOperator>(lhs,rhs,result); }
+
+    //! Element wise subtraction of `lhs` and `rhs`, stored in `result`
+    friend void subtract(
+        std::span<const BasicGeneralType> lhs, std::span<const BasicGeneralType> rhs, std::span<BasicGeneralType> result
+    ) requires(declaresBinary<SubtractionOperator>) { bulkOperator<SubtractionOperator>(lhs,rhs,result); }
+
+    //! Element wise multiplication of `lhs` and `rhs`, stored in `result`
+    friend void multiply(
+        std::span<const BasicGeneralType> lhs, std::span<const BasicGeneralType> rhs, std::span<BasicGeneralType> result
+    ) requires(declaresBinary<MultiplicationOperator>) { bulkOperator<MultiplicationOperator>(lhs,rhs,result); }
+
+    //! Element wise division of `lhs` and `rhs`, stored in `result`
+    friend void divide(
+        std::span<const BasicGeneralType> lhs, std::span<const BasicGeneralType> rhs, std::span<BasicGeneralType> result
+    ) requires(declaresBinary<DivisionOperator>) { bulkOperator<DivisionOperator>(lhs,rhs,result); }
+
+    //! Element wise `lhs < rhs`, stored in `result`
+    friend void compareSmaller(
+        std::span<const BasicGeneralType> lhs, std::span<const BasicGeneralType> rhs, std::span<BasicGeneralType> result
+    ) requires(declaresBinary<SmallerComparisonOperator>) { bulkOperator<SmallerComparisonOperator>(lhs,rhs,result); }
+
+    //! Element wise `lhs > rhs`, stored in `result`
+    friend void compareLarger(
+        std::span<const BasicGeneralType> lhs, std::span<const BasicGeneralType> rhs, std::span<BasicGeneralType> result
+    ) requires(declaresBinary<LargerComparisonOperator>) { bulkOperator<LargerComparisonOperator>(lhs,rhs,result); }
+
+    //! Element wise `lhs <= rhs`, stored in `result`
+    friend void compareSmallerEqual(
+        std::span<const BasicGeneralType> lhs, std::span<const BasicGeneralType> rhs, std::span<BasicGeneralType> result
+    ) requires(declaresBinary<SmallerEqualComparisonOperator>) { bulkOperator<SmallerEqualComparisonOperator>(lhs,rhs,result); }
+
+    //! Element wise `lhs >= rhs`, stored in `result`
+    friend void compareLargerEqual(
+        std::span<const BasicGeneralType> lhs, std::span<const BasicGeneralType> rhs, std::span<BasicGeneralType> result
+    ) requires(declaresBinary<LargerEqualComparisonOperator>) { bulkOperator<LargerEqualComparisonOperator>(lhs,rhs,result); }
+
+    //! Element wise `lhs == rhs`, stored in `result`
+    friend void compareEqual(
+        std::span<const BasicGeneralType> lhs, std::span<const BasicGeneralType> rhs, std::span<BasicGeneralType> result
+    ) requires(declaresBinary<EqualityComparisonOperator>) { bulkOperator<EqualityComparisonOperator>(lhs,rhs,result); }
+
+    //! Element wise `lhs != rhs`, stored in `result`
+    friend void compareNotEqual(
+        std::span<const BasicGeneralType> lhs, std::span<const BasicGeneralType> rhs, std::span<BasicGeneralType> result
+    ) requires(declaresBinary<InequalityComparisonOperator>) { bulkOperator<InequalityComparisonOperator>(lhs,rhs,result); }
+
+    //! Element wise conversion of `values` to `Type`, stored in `result`, e.g. `convert_all<double>(values,result)`.
+    //! Every run of elements holding the same alternative is dispatched once and converted in one loop.
+    template<typename Type>
+        requires( declaresConversion<Type, const Types_ &...> )
+    friend void convert_all(std::span<const BasicGeneralType> values, std::span<Type> result){
+        static constexpr auto table = makeConversionRunTable<Type>(std::make_index_sequence<numberOfAlternatives>{});
+
+        if( values.size() != result.size() ){
+            throw std::invalid_argument("Element wise conversion requires spans of equal size");
+        }
+
+        for(std::size_t begin = 0, end = 0; begin < values.size(); begin = end){
+            const std::size_t index = values[begin].obj_.index();
+            if( index == std::variant_npos ) [[unlikely]] {
+                throw std::bad_variant_access();
+            }
+            for(end = begin + 1; end < values.size() && values[end].obj_.index() == index; ++end){}
+            table[index](values.data() + begin, result.data() + begin, end - begin);
+        }
     }
- 
-    //! Subtraction assignment operator, forwards to the addition operator of the held type
-    GeneralType<Types_...> operator-=(GeneralType<Types_...> rhs){
-        std::visit(
-            [&rhs](auto & lhs_arg){
-                return std::visit(
-                    [&lhs_arg] (auto & rhs_arg){
-                        if constexpr ( areSubtractAssignable<decltype(lhs_arg),decltype(rhs_arg)> ){
-                            lhs_arg -= rhs_arg;
-                        } else {
-                            throw std::runtime_error(
-                                "Can not invoke operator-= on held types (" 
-                                + typeToString<decltype(lhs_arg)>() + " and " 
-                                + typeToString<decltype(rhs_arg)>() + ")"
-                            );
-                        }
-                    },
-                    rhs.obj_
-                );
-            },
-            this->obj_
-        );
 
-        return *this;
+    protected:
+
+    //! Number of alternatives in the underlying `std::variant`
+    static constexpr std::size_t numberOfAlternatives = std::variant_size_v<Variant>;
+
+    //! The held variant of a `GeneralType` forwarded with the value category of `GenType`
+    template<typename GenType>
+    using ForwardedVariant = decltype((std::declval<GenType>().obj_));
+
+    //! Access the `Index`-th alternative of `var` without checking, preserving the value category
+    template<std::size_t Index, typename VariantRef>
+    static decltype(auto) getUnchecked(VariantRef && var){
+        if constexpr( std::is_lvalue_reference_v<VariantRef> ){
+            return *std::get_if<Index>(&var);
+        } else {
+            return std::move(*std::get_if<Index>(&var));
+        }
     }
 
-    //! Multiplication assignment operator, forwards to the addition operator of the held type
-    GeneralType<Types_...> operator*=(GeneralType<Types_...> rhs){
-        std::visit(
-            [&rhs](auto & lhs_arg){
-                return std::visit(
-                    [&lhs_arg] (auto & rhs_arg){
-                        if constexpr ( areMultiplyAssignable<decltype(lhs_arg),decltype(rhs_arg)> ){
-                            lhs_arg *= rhs_arg;
-                        } else {
-                            throw std::runtime_error(
-                                "Can not invoke operator*= on held types (" 
-                                + typeToString<decltype(lhs_arg)>() + " and " 
-                                + typeToString<decltype(rhs_arg)>() + ")"
-                            );
-                        }
-                    },
-                    rhs.obj_
-                );
-            },
-            this->obj_
-        );
+    //! Checks if `Operation` is defined for `Lhs` and `Rhs` and its result can be held by a `GeneralType`
+    template<typename Operation, typename Lhs, typename Rhs>
+    static consteval bool isDispatchable(){
+        if constexpr( Operation::template isSupported<Lhs,Rhs> ){
+            return std::is_constructible_v<
+                Variant, decltype(Operation::apply(std::declval<Lhs>(),std::declval<Rhs>()))
+            >;
+        } else {
+            return false;
+        }
+    }
 
-        return *this;
+    //! Name of the `index`-th alternative of the underlying variant, used for error messages
+    static std::string alternativeName(std::size_t index){
+        static const std::array<std::string (*)(), numberOfAlternatives> names = {
+            &typeToString<long int>, &typeToString<Types_>...
+        };
+        return index < numberOfAlternatives ? names[index]() : "valueless";
     }
 
-    //! Division assignment operator, forwards to the addition operator of the held type
-    GeneralType<Types_...> operator/=(GeneralType<Types_...> rhs){
-        std::visit(
-            [&rhs](auto & lhs_arg){
-                return std::visit(
-                    [&lhs_arg] (auto & rhs_arg){
-                        if constexpr ( areDivisionAssignable<decltype(lhs_arg),decltype(rhs_arg)> ){
-                            lhs_arg /= rhs_arg;
-                        } else {
-                            throw std::runtime_error(
-                                "Can not invoke operator/= on held types (" 
-                                + typeToString<decltype(lhs_arg)>() + " and " 
-                                + typeToString<decltype(rhs_arg)>() + ")"
-                            );
-                        }
-                    },
-                    rhs.obj_
-                );
-            },
-            this->obj_
+    // The binary operators dispatch through a flat table with one function pointer per pair of 
+    // alternatives, indexed by `lhs.index() * numberOfAlternatives + rhs.index()`. 
+    // All pairs the operator is not defined for point to the same error entry.
+
+    //! Table entry of a binary operator, applies `Operation` to the alternatives `LhsIndex` and `RhsIndex`
+    template<typename Operation, typename LhsVariant, typename RhsVariant, std::size_t LhsIndex, std::size_t RhsIndex>
+    static BasicGeneralType binaryEntry(LhsVariant lhs, RhsVariant rhs){
+        return BasicGeneralType(
+            Operation::apply(
+                getUnchecked<LhsIndex>(std::forward<LhsVariant>(lhs)),
+                getUnchecked<RhsIndex>(std::forward<RhsVariant>(rhs))
+            )
         );
+    }
 
-        return *this;
+    //! Shared table entry of all pairs of alternatives a binary operator is not defined for
+    template<typename Operation, typename LhsVariant, typename RhsVariant>
+    [[noreturn]] static BasicGeneralType unsupportedBinaryEntry(LhsVariant lhs, RhsVariant rhs){
+        ErrorPolicy::unsupported([&lhs,&rhs]{
+            return "Can not invoke " + std::string(Operation::name) + " on held types (" 
+                + alternativeName(lhs.index()) + " and " 
+                + alternativeName(rhs.index()) + ")";
+        });
     }
 
-    //! Modulus assignment operator, forwards to the addition operator of the held type
-    GeneralType<Types_...> operator%=(GeneralType<Types_...> rhs){
-        std::visit(
-            [&rhs](auto & lhs_arg){
-                return std::visit(
-                    [&lhs_arg] (auto & rhs_arg){
-                        if constexpr ( areModulusAssignable<decltype(lhs_arg),decltype(rhs_arg)> ){
-                            lhs_arg %= rhs_arg;
-                        } else {
-                            throw std::runtime_error(
-                                "Can not invoke operator%= on held types (" 
-                                + typeToString<decltype(lhs_arg)>() + " and " 
-                                + typeToString<decltype(rhs_arg)>() + ")"
-                            );
-                        }
-                    },
-                    rhs.obj_
-                );
-            },
-            this->obj_
-        );
+    //! Select the table entry of a binary operator for the alternatives `LhsIndex` and `RhsIndex`
+    template<typename Operation, typename LhsVariant, typename RhsVariant, std::size_t LhsIndex, std::size_t RhsIndex>
+    static constexpr auto selectBinaryEntry(){
+        using LhsType = decltype(getUnchecked<LhsIndex>(std::declval<LhsVariant>()));
+        using RhsType = decltype(getUnchecked<RhsIndex>(std::declval<RhsVariant>()));
+        if constexpr ( isDispatchable<Operation,LhsType,RhsType>() ){
+            return &binaryEntry<Operation,LhsVariant,RhsVariant,LhsIndex,RhsIndex>;
+        } else {
+            return &unsupportedBinaryEntry<Operation,LhsVariant,RhsVariant>;
+        }
+    }
 
-        return *this;
+    //! Generate the dispatch table of a binary operator at compile time
+    template<typename Operation, typename LhsVariant, typename RhsVariant, std::size_t ... Indices>
+    static constexpr auto makeBinaryTable(std::index_sequence<Indices...>){
+        using Entry = BasicGeneralType (*)(LhsVariant, RhsVariant);
+        return std::array<Entry, sizeof...(Indices)>{
+            selectBinaryEntry<
+                Operation, LhsVariant, RhsVariant,
+                Indices / numberOfAlternatives, Indices % numberOfAlternatives
+            >()...
+        };
     }
 
-    //! Bitwise AND assignment operator, forwards to the addition operator of the held type
-    GeneralType<Types_...> operator&=(GeneralType<Types_...> rhs){
-        std::visit(
-            [&rhs](auto & lhs_arg){
-                return std::visit(
-                    [&lhs_arg] (auto & rhs_arg){
-                        if constexpr (areBitwiseAndAssignable<decltype(lhs_arg),decltype(rhs_arg)> ){
-                            lhs_arg &= rhs_arg;
-                        } else {
-                            throw std::runtime_error(
-                                "Can not invoke operator&= on held types (" 
-                                + typeToString<decltype(lhs_arg)>() + " and " 
-                                + typeToString<decltype(rhs_arg)>() + ")"
-                            );
-                        }
-                    },
-                    rhs.obj_
-                );
-            },
-            this->obj_
+    //! Forwards a binary operator to the held types of `lhs` and `rhs`.
+    //! The held objects are passed on with the value category of the respective `GeneralType`,
+    //! i.e. r-value `GeneralType`s give away their held object.
+    template<typename Operation, typename LhsGenType, typename RhsGenType>
+    static BasicGeneralType binaryOperator(LhsGenType && lhs, RhsGenType && rhs){
+        using LhsVariant = ForwardedVariant<LhsGenType>;
+        using RhsVariant = ForwardedVariant<RhsGenType>;
+        static constexpr auto table = makeBinaryTable<Operation,LhsVariant,RhsVariant>(
+            std::make_index_sequence<numberOfAlternatives * numberOfAlternatives>{}
         );
 
-        return *this;
-    }
+        if( lhs.obj_.valueless_by_exception() || rhs.obj_.valueless_by_exception() ) [[unlikely]] {
+            throw std::bad_variant_access();
+        }
 
-    //! Bitwise Inclusive OR assignment operator, forwards to the addition operator of the held type
-    GeneralType<Types_...> operator|=(GeneralType<Types_...> rhs){
-        std::visit(
-            [&rhs,this](auto & lhs_arg){
-                return std::visit(
-                    [&lhs_arg,this] (auto & rhs_arg){
-                        if constexpr (areBitwiseInclusiveOrAssignable<decltype(lhs_arg),decltype(rhs_arg)> ){
-                            lhs_arg |= rhs_arg;
-                        } else {
-                            throw std::runtime_error(
-                                "Can not invoke operator|= on held types (" 
-                                + typeToString<decltype(lhs_arg)>() + " and " 
-                                + typeToString<decltype(rhs_arg)>() + ")"
-                            );
-                        }
-                    },
-                    rhs.obj_
-                );
-            },
-            this->obj_
+        return table[lhs.obj_.index() * numberOfAlternatives + rhs.obj_.index()](
+            std::forward<LhsGenType>(lhs).obj_, std::forward<RhsGenType>(rhs).obj_
         );
+    }
 
-        return *this;
+    //! Index of the alternative a compound assignment stores its result in: the type of `lhs op rhs` if it
+    //! is an alternative wider than the alternative `LhsIndex`, e.g. `double` for `int += double`, `LhsIndex` otherwise
+    template<typename Operation, typename RhsVariant, std::size_t LhsIndex, std::size_t RhsIndex>
+    static constexpr std::size_t promotedIndex(){
+        using LhsType = std::variant_alternative_t<LhsIndex,Variant>;
+        using RhsType = decltype(getUnchecked<RhsIndex>(std::declval<RhsVariant>()));
+        if constexpr( requires { typename Operation::Binary; } ){
+            if constexpr( Operation::Binary::template isSupported<LhsType &&,RhsType> ){
+                using Result = std::remove_cvref_t<decltype(
+                    Operation::Binary::apply(std::declval<LhsType &&>(), std::declval<RhsType>())
+                )>;
+                constexpr std::size_t index = indexOfType<Result, long int, Types_...>();
+                if constexpr( index < numberOfAlternatives && !std::is_same_v<Result, typename UnaryPromoted<LhsType>::type> ){
+                    return index;
+                }
+            }
+        }
+        return LhsIndex;
     }
 
-    //! Exclusive OR assignment operator, forwards to the addition operator of the held type
-    GeneralType<Types_...> operator^=(GeneralType<Types_...> rhs){
-        std::visit(
-            [&rhs,this](auto & lhs_arg){
-                return std::visit(
-                    [&lhs_arg,this] (auto & rhs_arg){
-                        if constexpr (areExclusiveOrAssignable<decltype(lhs_arg),decltype(rhs_arg)> ){
-                            lhs_arg ^= rhs_arg;
-                        } else {
-                            throw std::runtime_error(
-                                "Can not invoke operator^= on held types (" 
-                                + typeToString<decltype(lhs_arg)>() + " and " 
-                                + typeToString<decltype(rhs_arg)>() + ")"
-                            );
-                        }
-                    },
-                    rhs.obj_
-                );
-            },
-            this->obj_
-        );
+    //! Table entry of a compound assignment operator, applies `Operation` to the alternatives `LhsIndex` and `RhsIndex`.
+    //! The held object is modified in place unless the result has a wider type, which replaces it.
+    template<typename Operation, typename RhsVariant, std::size_t LhsIndex, std::size_t RhsIndex>
+    static void assignmentEntry(Variant & lhs, RhsVariant rhs){
+        constexpr std::size_t resultIndex = promotedIndex<Operation,RhsVariant,LhsIndex,RhsIndex>();
+        if constexpr( resultIndex != LhsIndex ){
+            auto result = Operation::Binary::apply(
+                std::move(getUnchecked<LhsIndex>(lhs)),
+                getUnchecked<RhsIndex>(std::forward<RhsVariant>(rhs))
+            );
+            lhs.template emplace<resultIndex>(std::move(result));
+        } else {
+            Operation::apply(
+                getUnchecked<LhsIndex>(lhs),
+                getUnchecked<RhsIndex>(std::forward<RhsVariant>(rhs))
+            );
+        }
+    }
 
-        return *this;
+    //! Shared table entry of all pairs of alternatives a compound assignment operator is not defined for
+    template<typename Operation, typename RhsVariant>
+    [[noreturn]] static void unsupportedAssignmentEntry(Variant & lhs, RhsVariant rhs){
+        ErrorPolicy::unsupported([&lhs,&rhs]{
+            return "Can not invoke " + std::string(Operation::name) + " on held types (" 
+                + alternativeName(lhs.index()) + " and " 
+                + alternativeName(rhs.index()) + ")";
+        });
     }
-    
-    //! Right shift assignment operator, forwards to the addition operator of the held type
-    GeneralType<Types_...> operator>>=(GeneralType<Types_...> rhs){
-        std::visit(
-            [&rhs,this](auto & lhs_arg){
-                return std::visit(
-                    [&lhs_arg,this] (auto & rhs_arg){
-                        if constexpr (areRightShiftAssignable<decltype(lhs_arg),decltype(rhs_arg)> ){
-                            lhs_arg >>= rhs_arg;
-                        } else {
-                            throw std::runtime_error(
-                                "Can not invoke operator>>= on held types (" 
-                                + typeToString<decltype(lhs_arg)>() + " and " 
-                                + typeToString<decltype(rhs_arg)>() + ")"
-                            );
-                        }
-                    },
-                    rhs.obj_
-                );
-            },
-            this->obj_
+
+    //! Select the table entry of a compound assignment operator for the alternatives `LhsIndex` and `RhsIndex`
+    template<typename Operation, typename RhsVariant, std::size_t LhsIndex, std::size_t RhsIndex>
+    static constexpr auto selectAssignmentEntry(){
+        using LhsType = decltype(getUnchecked<LhsIndex>(std::declval<Variant&>()));
+        using RhsType = decltype(getUnchecked<RhsIndex>(std::declval<RhsVariant>()));
+        if constexpr ( Operation::template isSupported<LhsType,RhsType> ){
+            return &assignmentEntry<Operation,RhsVariant,LhsIndex,RhsIndex>;
+        } else {
+            return &unsupportedAssignmentEntry<Operation,RhsVariant>;
+        }
+    }
+
+    //! Generate the dispatch table of a compound assignment operator at compile time
+    template<typename Operation, typename RhsVariant, std::size_t ... Indices>
+    static constexpr auto makeAssignmentTable(std::index_sequence<Indices...>){
+        using Entry = void (*)(Variant &, RhsVariant);
+        return std::array<Entry, sizeof...(Indices)>{
+            selectAssignmentEntry<
+                Operation, RhsVariant,
+                Indices / numberOfAlternatives, Indices % numberOfAlternatives
+            >()...
+        };
+    }
+
+    //! Forwards a compound assignment operator to the held types of `this` and `rhs`.
+    template<typename Operation, typename RhsGenType>
+    BasicGeneralType & assignmentOperator(RhsGenType && rhs){
+        using RhsVariant = ForwardedVariant<RhsGenType>;
+        static constexpr auto table = makeAssignmentTable<Operation,RhsVariant>(
+            std::make_index_sequence<numberOfAlternatives * numberOfAlternatives>{}
         );
 
-        return *this;
-    }   
-    
-    //! Left shift assignment operator, forwards to the addition operator of the held type
-    GeneralType<Types_...> operator<<=(GeneralType<Types_...> rhs){
-        std::visit(
-            [&rhs,this](auto & lhs_arg){
-                return std::visit(
-                    [&lhs_arg,this] (auto & rhs_arg){
-                        if constexpr (areLeftShiftAssignable<decltype(lhs_arg),decltype(rhs_arg)> ){
-                            lhs_arg <<= rhs_arg;
-                        } else {
-                            throw std::runtime_error(
-                                "Can not invoke operator<<= on held types (" 
-                                + typeToString<decltype(lhs_arg)>() + " and " 
-                                + typeToString<decltype(rhs_arg)>() + ")"
-                            );
-                        }
-                    },
-                    rhs.obj_
-                );
-            },
-            this->obj_
+        if( this->obj_.valueless_by_exception() || rhs.obj_.valueless_by_exception() ) [[unlikely]] {
+            throw std::bad_variant_access();
+        }
+
+        table[this->obj_.index() * numberOfAlternatives + rhs.obj_.index()](
+            this->obj_, std::forward<RhsGenType>(rhs).obj_
         );
 
         return *this;
     }
 
-    // =========================================================================================
-    // External Operators
-    // =========================================================================================
-    
-    //! A function, that checks if `Type` is held by provided GeneralType
-    template<typename Type, typename ... Types>
-    friend constexpr bool holdsType( const GeneralType<Types...> & gt ){
-        if constexpr( (std::is_same_v<Type,Types> || ... ) ){
-            return std::holds_alternative<Type>(gt.obj_);
+    // The conversion operators dispatch through a table with one function pointer per alternative, 
+    // generated at compile time for every target type. Alternatives that can not be converted share 
+    // one entry, which reports the error.
+
+    //! Table entry of the conversion of the alternative `Index` to `Type`
+    template<typename Type, typename VariantRef, std::size_t Index>
+    static Type conversionEntry(VariantRef var){
+        using HeldType = decltype(getUnchecked<Index>(std::forward<VariantRef>(var)));
+        if constexpr( std::is_convertible_v<HeldType,Type> ){
+            return static_cast<Type>(getUnchecked<Index>(std::forward<VariantRef>(var)));
         } else {
-            return false;
+            return Type(getUnchecked<Index>(std::forward<VariantRef>(var)));
         }
     }
 
-    //! Addition operator with non-GeneralType, forwards to the addition operator of the held type
-    template<typename Type, typename ... Types>
-        requires((std::is_same_v<Type,Types> || ... ))
-    friend GeneralType<Types...> operator+(const Type & LHS, const GeneralType<Types...> & RHS ){
-        return std::visit(
-            [&LHS](auto & rhs_arg){
-                if constexpr (areAddable<decltype(LHS),decltype(rhs_arg)> ){
-                    return GeneralType<Types...>(LHS + rhs_arg);
-                } else {
-                    throw std::runtime_error(
-                        "Can not invoke operator+(Type, GeneralType) on held types (" 
-                        + typeToString<decltype(LHS)>() + " and " 
-                        + typeToString<decltype(rhs_arg)>() + ")"
-                    );
-
-                    return GeneralType<Types...>(rhs_arg);
-                }    
-            },
-            RHS.obj_
-        );
+    //! Shared table entry of all alternatives that can not be converted to `Type`
+    template<typename Type, typename VariantRef>
+    [[noreturn]] static Type unsupportedConversionEntry(VariantRef var){
+        ErrorPolicy::unsupported([&var]{
+            return "Can not convert held type (" + alternativeName(var.index()) 
+                + ") to desired Type (" + typeToString<Type>() + ")";
+        });
     }
 
-    //! Subtraction operator with non-GeneralType, forwards to the subtraction operator of the held type
-    template<typename Type, typename ... Types>
-        requires((std::is_same_v<Type,Types> || ... ))
-    friend GeneralType<Types...> operator-(const Type & LHS, const GeneralType<Types...> & RHS ){
-        return std::visit(
-            [&LHS](auto & rhs_arg){
-                if constexpr (areSubtractable<decltype(LHS),decltype(rhs_arg)> ){
-                    return GeneralType<Types...>(LHS - rhs_arg);
-                } else {
-                    throw std::runtime_error(
-                        "Can not invoke operator-(Type, GeneralType) on held types (" 
-                        + typeToString<decltype(LHS)>() + " and " 
-                        + typeToString<decltype(rhs_arg)>() + ")"
-                    );
-    
-                    return GeneralType<Types...>(rhs_arg);
-                }    
-            },
-            RHS.obj_
-        );
+    //! Select the table entry of the conversion of the alternative `Index` to `Type`
+    template<typename Type, typename VariantRef, std::size_t Index>
+    static constexpr auto selectConversionEntry(){
+        using HeldType = decltype(getUnchecked<Index>(std::declval<VariantRef>()));
+        if constexpr( isConvertibleTo<HeldType,Type> ){
+            return &conversionEntry<Type,VariantRef,Index>;
+        } else {
+            return &unsupportedConversionEntry<Type,VariantRef>;
+        }
     }
 
-    //! Multiplication operator with non-GeneralType, forwards to the multiplication operator of the held type
-    template<typename Type, typename ... Types>
-        requires((std::is_same_v<Type,Types> || ... ))
-    friend GeneralType<Types...> operator*(const Type & LHS, const GeneralType<Types...> & RHS ){
-        return std::visit(
-            [&LHS](auto & rhs_arg){
-                if constexpr (areMultipliable<decltype(LHS),decltype(rhs_arg)> ){
-                    return GeneralType<Types...>(LHS * rhs_arg);
-                } else {
-                    throw std::runtime_error(
-                        "Can not invoke operator*(Type, GeneralType) on held types (" 
-                        + typeToString<decltype(LHS)>() + " and " 
-                        + typeToString<decltype(rhs_arg)>() + ")"
-                    );
-    
-                    return GeneralType<Types...>(rhs_arg);
-                }    
-            },
-            RHS.obj_
-        );
+    //! Generate the dispatch table of the conversion to `Type` at compile time
+    template<typename Type, typename VariantRef, std::size_t ... Indices>
+    static constexpr auto makeConversionTable(std::index_sequence<Indices...>){
+        using Entry = Type (*)(VariantRef);
+        return std::array<Entry, sizeof...(Indices)>{ selectConversionEntry<Type,VariantRef,Indices>()... };
     }
 
-    //! Devision operator with non-GeneralType, forwards to the multiplication operator of the held type
-    template<typename Type, typename ... Types>
-        requires((std::is_same_v<Type,Types> || ... ))
-    friend GeneralType<Types...> operator/(const Type & LHS, const GeneralType<Types...> & RHS ){
-        return std::visit(
-            [&LHS](auto & rhs_arg){
-                if constexpr (areDivisible<decltype(LHS),decltype(rhs_arg)> ){
-                    return GeneralType<Types...>(LHS / rhs_arg);
-                } else {
-                    throw std::runtime_error(
-                        "Can not invoke operator/(Type, GeneralType) on held types (" 
-                        + typeToString<decltype(LHS)>() + " and " 
-                        + typeToString<decltype(rhs_arg)>() + ")"
-                    );
-    
-                    return GeneralType<Types...>(rhs_arg);
-                }    
-            },
-            RHS.obj_
+    //! Converts the held object of `genT` to `Type`
+    template<typename Type, typename GenType>
+    static Type conversionOperator(GenType & genT){
+        using VariantRef = decltype((genT.obj_));
+        static constexpr auto table = makeConversionTable<Type,VariantRef>(
+            std::make_index_sequence<numberOfAlternatives>{}
         );
+
+        if( genT.obj_.valueless_by_exception() ) [[unlikely]] {
+            throw std::bad_variant_access();
+        }
+
+        return table[genT.obj_.index()](genT.obj_);
     }
 
-    //! Modulus operator with non-GeneralType, forwards to the multiplication operator of the held type
-    template<typename Type, typename ... Types>
-        requires((std::is_same_v<Type,Types> || ... ))
-    friend GeneralType<Types...> operator%(const Type & LHS, const GeneralType<Types...> & RHS ){
-        return std::visit(
-            [&LHS](auto & rhs_arg){
-                if constexpr (areModulus<decltype(LHS),decltype(rhs_arg)> ){
-                    return GeneralType<Types...>(LHS % rhs_arg);
-                } else {
-                    throw std::runtime_error(
-                        "Can not invoke operator%(Type, GeneralType) on held types (" 
-                        + typeToString<decltype(LHS)>() + " and " 
-                        + typeToString<decltype(rhs_arg)>() + ")"
-                    );
-    
-                    return GeneralType<Types...>(rhs_arg);
-                }    
-            },
-            RHS.obj_
-        );
+    //! Table entry of `convert_all`, converts `count` elements holding the alternative `Index` to `Type`
+    template<typename Type, std::size_t Index>
+    static void conversionRunEntry(const BasicGeneralType * values, Type * result, std::size_t count){
+        for(std::size_t k = 0; k < count; ++k){
+            result[k] = conversionEntry<Type,const Variant &,Index>(values[k].obj_);
+        }
     }
 
-    //! Bitwise AND operator with non-GeneralType, forwards to the multiplication operator of the held type
-    template<typename Type, typename ... Types>
-        requires((std::is_same_v<Type,Types> || ... ))
-    friend GeneralType<Types...> operator&(const Type & LHS, const GeneralType<Types...> & RHS ){
-        return std::visit(
-            [&LHS](auto & rhs_arg){
-                if constexpr (areBitwiseAndable<decltype(LHS),decltype(rhs_arg)> ){
-                    return GeneralType<Types...>(LHS & rhs_arg);
-                } else {
-                    throw std::runtime_error(
-                        "Can not invoke operator&(Type, GeneralType) on held types (" 
-                        + typeToString<decltype(LHS)>() + " and " 
-                        + typeToString<decltype(rhs_arg)>() + ")"
-                    );
-    
-                    return GeneralType<Types...>(rhs_arg);
-                }    
-            },
-            RHS.obj_
-        );
+    //! Shared table entry of `convert_all` for all alternatives that can not be converted to `Type`
+    template<typename Type>
+    [[noreturn]] static void unsupportedConversionRunEntry(const BasicGeneralType * values, Type *, std::size_t){
+        unsupportedConversionEntry<Type,const Variant &>(values->obj_);
     }
 
-    //! Logically AND operator with non-GeneralType, forwards to the multiplication operator of the held type
-    template<typename Type, typename ... Types>
-        requires((std::is_same_v<Type,Types> || ... ))
-    friend GeneralType<Types...> operator&&(const Type & LHS, const GeneralType<Types...> & RHS ){
-        return std::visit(
-            [&LHS](auto & rhs_arg){
-                if constexpr (areLogicalAndable<decltype(LHS),decltype(rhs_arg)> ){
-                    return GeneralType<Types...>(LHS && rhs_arg);
-                } else {
-                    throw std::runtime_error(
-                        "Can not invoke operator&&(Type, GeneralType) on held types (" 
-                        + typeToString<decltype(LHS)>() + " and " 
-                        + typeToString<decltype(rhs_arg)>() + ")"
-                    );
-    
-                    return GeneralType<Types...>(rhs_arg);
-                }    
-            },
-            RHS.obj_
-        );
+    //! Select the table entry of `convert_all` to `Type` for the alternative `Index`
+    template<typename Type, std::size_t Index>
+    static constexpr auto selectConversionRunEntry(){
+        if constexpr( isConvertibleTo<const std::variant_alternative_t<Index,Variant> &, Type> ){
+            return &conversionRunEntry<Type,Index>;
+        } else {
+            return &unsupportedConversionRunEntry<Type>;
+        }
     }
 
-    //! Bitwise inclusive OR operator with non-GeneralType, forwards to the multiplication operator of the held type
-    template<typename Type, typename ... Types>
-        requires((std::is_same_v<Type,Types> || ... ))
-    friend GeneralType<Types...> operator|(const Type & LHS, const GeneralType<Types...> & RHS ){
-        return std::visit(
-            [&LHS](auto & rhs_arg){
-                if constexpr (areBitwiseInclusiveOrable<decltype(LHS),decltype(rhs_arg)> ){
-                    return GeneralType<Types...>(LHS | rhs_arg);
-                } else {
-                    throw std::runtime_error(
-                        "Can not invoke operator|(Type, GeneralType) on held types (" 
-                        + typeToString<decltype(LHS)>() + " and " 
-                        + typeToString<decltype(rhs_arg)>() + ")"
-                    );
-    
-                    return GeneralType<Types...>(rhs_arg);
-                }    
-            },
-            RHS.obj_
-        );
+    //! Generate the dispatch table of `convert_all` to `Type` at compile time
+    template<typename Type, std::size_t ... Indices>
+    static constexpr auto makeConversionRunTable(std::index_sequence<Indices...>){
+        using Entry = void (*)(const BasicGeneralType *, Type *, std::size_t);
+        return std::array<Entry, sizeof...(Indices)>{ selectConversionRunEntry<Type,Indices>()... };
     }
 
-    //! Exclusive OR operator with non-GeneralType, forwards to the multiplication operator of the held type
-    template<typename Type, typename ... Types>
-        requires((std::is_same_v<Type,Types> || ... ))
-    friend GeneralType<Types...> operator^(const Type & LHS, const GeneralType<Types...> & RHS ){
+    //! Forwards a binary operator with a non-GeneralType `lhs` to the held type of `rhs`
+    template<typename Operation, typename Result, typename Type>
+    static Result mixedOperator(const Type & lhs, const BasicGeneralType & rhs){
         return std::visit(
-            [&LHS](auto & rhs_arg){
-                if constexpr (areExclusiveOrable<decltype(LHS),decltype(rhs_arg)> ){
-                    return GeneralType<Types...>(LHS ^ rhs_arg);
+            [&lhs](const auto & rhs_arg) -> Result {
+                constexpr bool isStorable = !std::is_same_v<Result,BasicGeneralType> 
+                    || isDispatchable<Operation,const Type &,decltype(rhs_arg)>();
+                if constexpr ( Operation::template isSupported<const Type &,decltype(rhs_arg)> && isStorable ){
+                    return Result(Operation::apply(lhs,rhs_arg));
                 } else {
-                    throw std::runtime_error(
-                        "Can not invoke operator^(Type, GeneralType) on held types (" 
-                        + typeToString<decltype(LHS)>() + " and " 
-                        + typeToString<decltype(rhs_arg)>() + ")"
-                    );
-    
-                    return GeneralType<Types...>(rhs_arg);
-                }    
+                    ErrorPolicy::unsupported([]{
+                        return "Can not invoke " + std::string(Operation::name) + "(Type, GeneralType) on held types (" 
+                            + typeToString<Type>() + " and " 
+                            + typeToString<std::remove_cvref_t<decltype(rhs_arg)>>() + ")";
+                    });
+                }
             },
-            RHS.obj_
+            rhs.obj_
         );
     }
 
-    //! Logical inclusive OR operator with non-GeneralType, forwards to the multiplication operator of the held type
-    template<typename Type, typename ... Types>
-        requires((std::is_same_v<Type,Types> || ... ))
-    friend GeneralType<Types...> operator||(const Type & LHS, const GeneralType<Types...> & RHS ){
-        return std::visit(
-            [&LHS](auto & rhs_arg){
-                if constexpr (areLogicalInclusiveOrable<decltype(LHS),decltype(rhs_arg)> ){
-                    return GeneralType<Types...>(LHS || rhs_arg);
-                } else {
-                    throw std::runtime_error(
-                        "Can not invoke operator||(Type, GeneralType) on held types (" 
-                        + typeToString<decltype(LHS)>() + " and " 
-                        + typeToString<decltype(rhs_arg)>() + ")"
-                    );
-    
-                    return GeneralType<Types...>(rhs_arg);
-                }    
-            },
-            RHS.obj_
-        );
+    // The bulk operators work on blocks of `bulkBlockSize` elements, which stay in the cache. A block is 
+    // grouped by the pairs of held alternatives with a counting sort and one table entry is called per group. 
+    // The entries loop either over a contiguous range (`indices` is null) or over the elements listed in 
+    // `indices`, with the alternatives known at compile time.
+
+    //! Number of elements the bulk operators group at once
+    static constexpr std::size_t bulkBlockSize = 1024;
+
+    //! Store `value` in `target`, reusing the held object if it already holds the type of `value`
+    template<typename Result>
+    static void storeBulkResult(BasicGeneralType & target, Result && value){
+        constexpr std::size_t alternative = indexOfType<std::remove_cvref_t<Result>, long int, Types_...>();
+        if constexpr( alternative < numberOfAlternatives ){
+            if( target.obj_.index() == alternative ){
+                *std::get_if<alternative>(&target.obj_) = std::forward<Result>(value);
+            } else {
+                target.obj_.template emplace<alternative>(std::forward<Result>(value));
+            }
+        } else {
+            target.obj_ = BasicGeneralType(std::forward<Result>(value)).obj_;
+        }
     }
 
-    //! Smaller operator with non-GeneralType, forwards to the multiplication operator of the held type
-    template<typename Type, typename ... Types>
-        requires((std::is_same_v<Type,Types> || ... ))
-    friend GeneralType<Types...> operator<(const Type & LHS, const GeneralType<Types...> & RHS ){
-        return std::visit(
-            [&LHS](auto & rhs_arg){
-                if constexpr (areSmallerComparable<decltype(LHS),decltype(rhs_arg)> ){
-                    return GeneralType<Types...>(LHS < rhs_arg);
-                } else {
-                    throw std::runtime_error(
-                        "Can not invoke operator<(Type, GeneralType) on held types (" 
-                        + typeToString<decltype(LHS)>() + " and " 
-                        + typeToString<decltype(rhs_arg)>() + ")"
-                    );
-    
-                    return GeneralType<Types...>(rhs_arg);
-                }    
-            },
-            RHS.obj_
-        );
+    //! Table entry of a bulk operator, applies `Operation` to `count` elements holding `LhsIndex` and `RhsIndex`
+    template<typename Operation, std::size_t LhsIndex, std::size_t RhsIndex>
+    static void bulkEntry(
+        const BasicGeneralType * lhs, const BasicGeneralType * rhs, BasicGeneralType * result, 
+        const std::size_t * indices, std::size_t count)
+    {
+        if( indices == nullptr ){
+            for(std::size_t k = 0; k < count; ++k){
+                storeBulkResult(result[k], 
+                    Operation::apply(getUnchecked<LhsIndex>(lhs[k].obj_), getUnchecked<RhsIndex>(rhs[k].obj_)));
+            }
+        } else {
+            for(std::size_t k = 0; k < count; ++k){
+                const std::size_t i = indices[k];
+                storeBulkResult(result[i], 
+                    Operation::apply(getUnchecked<LhsIndex>(lhs[i].obj_), getUnchecked<RhsIndex>(rhs[i].obj_)));
+            }
+        }
     }
 
-    //! Larger operator with non-GeneralType, forwards to the multiplication operator of the held type
-    template<typename Type, typename ... Types>
-        requires((std::is_same_v<Type,Types> || ... ))
-    friend GeneralType<Types...> operator>(const Type & LHS, const GeneralType<Types...> & RHS ){
-        return std::visit(
-            [&LHS](auto & rhs_arg){
-                if constexpr (areLargerComparable<decltype(LHS),decltype(rhs_arg)> ){
-                    return GeneralType<Types...>(LHS > rhs_arg);
-                } else {
-                    throw std::runtime_error(
-                        "Can not invoke operator>(Type, GeneralType) on held types (" 
-                        + typeToString<decltype(LHS)>() + " and " 
-                        + typeToString<decltype(rhs_arg)>() + ")"
-                    );
-    
-                    return GeneralType<Types...>(rhs_arg);
-                }    
-            },
-            RHS.obj_
-        );
+    //! Shared table entry of all pairs of alternatives a bulk operator is not defined for
+    template<typename Operation>
+    [[noreturn]] static void unsupportedBulkEntry(
+        const BasicGeneralType * lhs, const BasicGeneralType * rhs, BasicGeneralType *, 
+        const std::size_t * indices, std::size_t)
+    {
+        const std::size_t i = indices == nullptr ? 0 : indices[0];
+        ErrorPolicy::unsupported([&]{
+            return "Can not invoke element wise " + std::string(Operation::name) + " on held types (" 
+                + alternativeName(lhs[i].obj_.index()) + " and " 
+                + alternativeName(rhs[i].obj_.index()) + ")";
+        });
     }
 
-    //! Smaller-Equal operator with non-GeneralType, forwards to the multiplication operator of the held type
-    template<typename Type, typename ... Types>
-        requires((std::is_same_v<Type,Types> || ... ))
-    friend GeneralType<Types...> operator<=(const Type & LHS, const GeneralType<Types...> & RHS ){
-        return std::visit(
-            [&LHS](auto & rhs_arg){
-                if constexpr (areSmallerEqualComparable<decltype(LHS),decltype(rhs_arg)> ){
-                    return GeneralType<Types...>(LHS <= rhs_arg);
-                } else {
-                    throw std::runtime_error(
-                        "Can not invoke operator<=(Type, GeneralType) on held types (" 
-                        + typeToString<decltype(LHS)>() + " and " 
-                        + typeToString<decltype(rhs_arg)>() + ")"
-                    );
-    
-                    return GeneralType<Types...>(rhs_arg);
-                }    
-            },
-            RHS.obj_
-        );
+    //! Select the table entry of a bulk operator for the alternatives `LhsIndex` and `RhsIndex`
+    template<typename Operation, std::size_t LhsIndex, std::size_t RhsIndex>
+    static constexpr auto selectBulkEntry(){
+        using LhsType = decltype(getUnchecked<LhsIndex>(std::declval<const Variant &>()));
+        using RhsType = decltype(getUnchecked<RhsIndex>(std::declval<const Variant &>()));
+        if constexpr ( isDispatchable<Operation,LhsType,RhsType>() ){
+            return &bulkEntry<Operation,LhsIndex,RhsIndex>;
+        } else {
+            return &unsupportedBulkEntry<Operation>;
+        }
     }
 
-    //! Larger-Equal operator with non-GeneralType, forwards to the multiplication operator of the held type
-    template<typename Type, typename ... Types>
-        requires((std::is_same_v<Type,Types> || ... ))
-    friend GeneralType<Types...> operator>=(const Type & LHS, const GeneralType<Types...> & RHS ){
-        return std::visit(
-            [&LHS](auto & rhs_arg){
-                if constexpr (areLargerEqualComparable<decltype(LHS),decltype(rhs_arg)> ){
-                    return GeneralType<Types...>(LHS >= rhs_arg);
-                } else {
-                    throw std::runtime_error(
-                        "Can not invoke operator>=(Type, GeneralType) on held types (" 
-                        + typeToString<decltype(LHS)>() + " and " 
-                        + typeToString<decltype(rhs_arg)>() + ")"
-                    );
-    
-                    return GeneralType<Types...>(rhs_arg);
-                }    
-            },
-            RHS.obj_
+    //! Generate the dispatch table of a bulk operator at compile time
+    template<typename Operation, std::size_t ... Indices>
+    static constexpr auto makeBulkTable(std::index_sequence<Indices...>){
+        using Entry = void (*)(
+            const BasicGeneralType *, const BasicGeneralType *, BasicGeneralType *, const std::size_t *, std::size_t
         );
+        return std::array<Entry, sizeof...(Indices)>{
+            selectBulkEntry<Operation, Indices / numberOfAlternatives, Indices % numberOfAlternatives>()...
+        };
     }
 
-    //! Equality operator with non-GeneralType, forwards to the multiplication operator of the held type
-    template<typename Type, typename ... Types>
-        requires((std::is_same_v<Type,Types> || ... ))
-    friend bool operator==(const Type & LHS, const GeneralType<Types...> & RHS ){
-        return std::visit(
-            [&LHS](auto & rhs_arg){
-                if constexpr (areEqualityComparable<decltype(LHS),decltype(rhs_arg)> ){
-                    return LHS == rhs_arg;
-                } else {
-                    throw std::runtime_error(
-                        "Can not invoke operator==(Type, GeneralType) on held types (" 
-                        + typeToString<decltype(LHS)>() + " and " 
-                        + typeToString<decltype(rhs_arg)>() + ")"
-                    );
-    
-                    return false;
-                }    
-            },
-            RHS.obj_
-        );
+    //! Index of the pair of alternatives held by `lhs` and `rhs` in the dispatch tables
+    static std::size_t pairIndex(const BasicGeneralType & lhs, const BasicGeneralType & rhs){
+        if( lhs.obj_.valueless_by_exception() || rhs.obj_.valueless_by_exception() ) [[unlikely]] {
+            throw std::bad_variant_access();
+        }
+        return lhs.obj_.index() * numberOfAlternatives + rhs.obj_.index();
     }
 
+    //! Applies `Operation` element wise to `lhs` and `rhs` and stores the results in `result`.
+    //! If the operator is not defined for the held types of an element, the results of the 
+    //! previous blocks have already been written.
+    template<typename Operation>
+    static void bulkOperator(
+        std::span<const BasicGeneralType> lhs, std::span<const BasicGeneralType> rhs, std::span<BasicGeneralType> result)
+    {
+        constexpr std::size_t numberOfPairs = numberOfAlternatives * numberOfAlternatives;
+        static constexpr auto table = makeBulkTable<Operation>(std::make_index_sequence<numberOfPairs>{});
+
+        if( lhs.size() != rhs.size() || lhs.size() != result.size() ){
+            throw std::invalid_argument("Element wise " + std::string(Operation::name) 
+                + " requires spans of equal size");
+        }
 
-    //! Equality operator with non-GeneralType, forwards to the multiplication operator of the held type
-    template<typename Type, typename ... Types>
-        requires((std::is_same_v<Type,Types> || ... ))
-    friend bool operator!=(const Type & LHS, const GeneralType<Types...> & RHS ){
-        return std::visit(
-            [&LHS](auto & rhs_arg){
-                if constexpr (areInequalityComparable<decltype(LHS),decltype(rhs_arg)> ){
-                    return LHS != rhs_arg;
-                } else {
-                    throw std::runtime_error(
-                        "Can not invoke operator!=(Type, GeneralType) on held types (" 
-                        + typeToString<decltype(LHS)>() + " and " 
-                        + typeToString<decltype(rhs_arg)>() + ")"
-                    );
-    
-                    return false;
-                }    
-            },
-            RHS.obj_
-        );
+        // Only allocated once a block holds more than one pair of alternatives
+        std::vector<std::size_t> pairs, indices, offsets;
+
+        for(std::size_t begin = 0; begin < lhs.size(); begin += bulkBlockSize){
+            const std::size_t count = std::min(bulkBlockSize, lhs.size() - begin);
+            const BasicGeneralType * lhsBlock = lhs.data() + begin;
+            const BasicGeneralType * rhsBlock = rhs.data() + begin;
+            BasicGeneralType * resultBlock = result.data() + begin;
+
+            // The common case, all elements hold the same pair of alternatives, needs no grouping
+            const std::size_t first = pairIndex(lhsBlock[0],rhsBlock[0]);
+            std::size_t uniform = 1;
+            while( uniform < count && pairIndex(lhsBlock[uniform],rhsBlock[uniform]) == first ){ ++uniform; }
+            if( uniform == count ){
+                table[first](lhsBlock, rhsBlock, resultBlock, nullptr, count);
+                continue;
+            }
+
+            // Counting sort of the block by the pairs of alternatives, afterwards `offsets[pair]` 
+            // is the end of the group of `pair` in `indices`
+            if( pairs.empty() ){
+                pairs.resize(bulkBlockSize);
+                indices.resize(bulkBlockSize);
+                offsets.resize(numberOfPairs + 1);
+            }
+            std::fill(offsets.begin(), offsets.end(), 0);
+            for(std::size_t k = 0; k < count; ++k){
+                pairs[k] = pairIndex(lhsBlock[k],rhsBlock[k]);
+                ++offsets[pairs[k] + 1];
+            }
+            for(std::size_t pair = 0; pair < numberOfPairs; ++pair){
+                offsets[pair + 1] += offsets[pair];
+            }
+            for(std::size_t k = 0; k < count; ++k){
+                indices[offsets[pairs[k]]++] = k;
+            }
+
+            for(std::size_t pair = 0, groupBegin = 0; pair < numberOfPairs; groupBegin = offsets[pair++]){
+                if( offsets[pair] != groupBegin ){
+                    table[pair](lhsBlock, rhsBlock, resultBlock, indices.data() + groupBegin, offsets[pair] - groupBegin);
+                }
+            }
+        }
     }
 
-    protected:
+    // Containers of GeneralTypes access the held variant directly
+    template<typename, typename ...> friend class BasicGeneralVector;
+
+    // Expressions of GeneralTypes access the held variant directly
+    template<typename, typename> friend class GeneralExpression;
+
+    // The binary format reads and writes the held variant directly
+    template<typename> friend struct BinaryFormat;
+
+    // References to the held object access the held variant directly
+    template<typename, bool> friend class BasicGeneralTypeRef;
+
+    // Snapshots read and write the held variant directly
+    template<typename> friend struct SnapshotFormat;
+
+    // The JSON writer reads the held variant directly
+    template<typename> friend struct JsonFormat;
+
+    // The compact storage moves objects in and out of the held variant directly
+    template<typename> friend class BasicCompactGeneralType;
+
+    // The NaN-boxed storage reads and writes the held variant directly
+    template<typename> friend class BasicNanBoxedGeneralType;
+
+    // The atomic storage copies the held object in and out of the held variant directly
+    template<typename> friend class BasicAtomicGeneralType;
 
     // Store the held element in a std::variant
     // The std::variant is the heart of this implementation, basically that is what the EntryImpl boils down to
     // The long int implements a fix for the subtraction operator. I don't understand why it is needed, but it works
-    std::variant<long int, Types_...> obj_;
-}; // GeneralType<Types_...>
+    Variant obj_;
+}; // BasicGeneralType<ErrorPolicy,Types_...>
+
+//! A `GeneralType` throws a `std::runtime_error` if an operator is not defined for the held types
+template<typename ... Types_>
+using GeneralType = BasicGeneralType<RuntimeErrorPolicy, Types_...>;
+
+//! A `StrictGeneralType` rejects operators not defined for any of the types at compile time
+template<typename ... Types_>
+using StrictGeneralType = BasicGeneralType<StrictErrorPolicy, Types_...>;
+
 
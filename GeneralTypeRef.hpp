@@ -0,0 +1,606 @@
+#pragma once
+
+#include "GeneralType.hpp"
+#include <array>
+#include <cstddef>
+#include <span>
+#include <utility>
+#include <variant>
+#include <vector>
+
+// Non-owning references to the object held by a GeneralType, or to any object of one of its types,
+// e.g. an element of a held std::vector. `borrow(genT)` returns a `GeneralTypeRef` for a mutable
+// GeneralType and a `GeneralTypeView` for a const one. References support the operators of the
+// GeneralType without copying the referenced object:
+//  - `ref[key]` references the element of the held container, if it has one of the types
+//  - the compound assignments, `++`, `--` and `ref = value` modify the referenced object in place
+//  - the other operators return a new GeneralType
+// Assigning to a `GeneralTypeRef` assigns to the referenced object and never changes its type, assigning to
+// a `GeneralTypeView` rebinds it like a `std::span`. References are invalidated like a pointer to the
+// referenced object, e.g. when another type is assigned to the GeneralType or a held vector is resized.
+
+//! A reference to an object of one of the types of `GenType`, which can be modified unless `Const`
+template<typename GenType, bool Const>
+class BasicGeneralTypeRef;
+
+namespace {
+
+//! Checks if `Type` is a reference to the objects of GeneralTypes of type `GenType`
+template<typename Type, typename GenType>
+constexpr bool isGeneralTypeRef = false;
+
+template<typename GenType, bool Const>
+constexpr bool isGeneralTypeRef<BasicGeneralTypeRef<GenType,Const>,GenType> = true;
+
+//! Plain assignment `operator=`, used to assign through a reference. Only objects of the same type or
+//! arithmetic values to arithmetic objects are assigned, e.g. an `int` is not assigned to a `std::string`
+//! by `std::string::operator=(char)`.
+struct ValueAssignmentOperator {
+    static constexpr const char * name = "operator=";
+    template<typename T, typename U> static constexpr bool isSupported = std::is_assignable_v<T,U>
+        && ( std::is_same_v<std::remove_cvref_t<T>,std::remove_cvref_t<U>>
+            || (std::is_arithmetic_v<std::remove_cvref_t<T>> && std::is_arithmetic_v<std::remove_cvref_t<U>>) );
+    template<typename T, typename U> static decltype(auto) apply(T && t, U && u){ return std::forward<T>(t) = std::forward<U>(u); }
+};
+
+} // namespace
+
+template<typename ErrorPolicy, typename ... Types_, bool Const>
+class BasicGeneralTypeRef<BasicGeneralType<ErrorPolicy,Types_...>,Const> {
+    protected:
+    using GenType = BasicGeneralType<ErrorPolicy,Types_...>;
+
+    //! Pointers to the alternatives of `GenType`. Mutable references are only created from mutable
+    //! objects, such that both kinds share this representation and cast the const away to modify.
+    using Variant = std::variant<const long int *, const Types_ *...>;
+
+    static constexpr std::size_t numberOfAlternatives = GenType::numberOfAlternatives;
+
+    //! Index of the alternative `Type`, `numberOfAlternatives` if `Type` is no alternative
+    template<typename Type>
+    static constexpr std::size_t indexOf = indexOfType<Type, long int, Types_...>();
+
+    //! Checks if `Type` can be an operand: a GeneralType of type `GenType`, a reference to one or one of its types
+    template<typename Type>
+    static constexpr bool isOperand = std::is_same_v<Type,GenType> || isGeneralTypeRef<Type,GenType>
+        || indexOf<Type> < numberOfAlternatives;
+
+    //! Checks if `container[key]` is an l-value of one of the types, which can be referenced
+    template<typename Container, typename Key>
+    static consteval bool isReferenceable(){
+        if constexpr( areAccessible<Container,Key> ){
+            using Element = decltype(std::declval<Container>()[std::declval<Key>()]);
+            return std::is_lvalue_reference_v<Element> && indexOf<std::remove_cvref_t<Element>> < numberOfAlternatives;
+        } else {
+            return false;
+        }
+    }
+
+    //! A binary operator is declared if it is declared for `GenType`
+    template<typename Operation>
+    static constexpr bool declaresBinary = GenType::template declaresBinary<Operation>;
+
+    //! A compound assignment operator is declared if it is declared for `GenType`
+    template<typename Operation>
+    static constexpr bool declaresAssignment = GenType::template declaresAssignment<Operation>;
+
+    //! The type the referenced objects are accessed as
+    template<typename Type>
+    using Access = std::conditional_t<Const, const Type &, Type &>;
+
+    public:
+    //! Reference the object held by `genT`
+    explicit BasicGeneralTypeRef(Access<GenType> genT) :
+        obj_(pointersOf(genT))
+    {}
+
+    //! Reference `value`, which has one of the types of `GenType`
+    template<typename Type>
+        requires( indexOf<std::remove_const_t<Type>> < numberOfAlternatives && (Const || !std::is_const_v<Type>) )
+    explicit BasicGeneralTypeRef(Type & value) :
+        obj_(std::in_place_index<indexOf<std::remove_const_t<Type>>>, &value)
+    {}
+
+    //! A `GeneralTypeRef` converts to a `GeneralTypeView` of the same object
+    BasicGeneralTypeRef(const BasicGeneralTypeRef<GenType,false> & ref) requires( Const ) :
+        obj_(ref.obj_)
+    {}
+
+    BasicGeneralTypeRef(const BasicGeneralTypeRef &) = default;
+
+    //! Rebind a `GeneralTypeView` to the object referenced by `view`
+    BasicGeneralTypeRef & operator=(const BasicGeneralTypeRef & view) requires( Const ) = default;
+
+    //! Assign the object referenced by `ref` to the referenced object
+    BasicGeneralTypeRef & operator=(const BasicGeneralTypeRef & ref) requires( !Const ) {
+        return assignmentOperator<ValueAssignmentOperator>(ref);
+    }
+
+    //! Assign `value`, a GeneralType, a reference or one of the types, to the referenced object.
+    //! The type of the referenced object does not change, the value is converted to it.
+    template<typename Type>
+        requires( !Const && isOperand<Type> )
+    BasicGeneralTypeRef & operator=(const Type & value){
+        return assignmentOperator<ValueAssignmentOperator>(value);
+    }
+
+    //! Index of the type of the referenced object, the same as in `GenType`
+    std::size_t index() const {
+        return obj_.index();
+    }
+
+    //! Check if the referenced object has the type `Type`
+    template<typename Type>
+    bool holds() const {
+        return obj_.index() == indexOf<Type>;
+    }
+
+    //! The referenced object, throws a `std::bad_variant_access` if it has another type than `Type`
+    template<typename Type>
+        requires( indexOf<Type> < numberOfAlternatives )
+    Access<Type> get() const {
+        return access(std::get<indexOf<Type>>(obj_));
+    }
+
+    //! The elements of the referenced `std::vector<Element>`, throws a `std::bad_variant_access` if it has another type
+    template<typename Element>
+        requires( indexOf<std::vector<Element>> < numberOfAlternatives )
+    std::span<std::conditional_t<Const, const Element, Element>> span() const {
+        return access(std::get<indexOf<std::vector<Element>>>(obj_));
+    }
+
+    //! Copy the referenced object into a GeneralType
+    GenType value() const {
+        return std::visit([](const auto * arg){ return GenType(*arg); }, obj_);
+    }
+
+    //! Put the referenced object to the out stream `os`
+    friend std::ostream & operator<<(std::ostream & os, const BasicGeneralTypeRef & ref)
+        requires( !ErrorPolicy::rejectAtCompileTime || (hasStreamingOperator<const Types_&> || ...) )
+    {
+        std::visit(
+            [&os](const auto * arg){
+                if constexpr( hasStreamingOperator<decltype(*arg)> ){
+                    os << *arg;
+                } else {
+                    ErrorPolicy::unsupported([]{
+                        return "Can not  invoke operator<< held type ("
+                            + typeToString<std::remove_cvref_t<decltype(*arg)>>() + ")";
+                    });
+                }
+            },
+            ref.obj_
+        );
+        return os;
+    }
+
+    // =========================================================================================
+    // Unary Operators
+    // =========================================================================================
+
+    //! Negation operator, forwards to the negation operator of the referenced object
+    GenType operator!() const
+        requires( !ErrorPolicy::rejectAtCompileTime || (hasNegationOperator<const Types_&> || ...) )
+    {
+        return std::visit(
+            [](const auto * arg) -> GenType {
+                if constexpr( hasNegationOperator<decltype(*arg)> ){
+                    return GenType(!*arg);
+                } else {
+                    ErrorPolicy::unsupported([]{
+                        return "Can not invoke operator! on held type ("
+                            + typeToString<std::remove_cvref_t<decltype(*arg)>>() + ")";
+                    });
+                }
+            },
+            obj_
+        );
+    }
+
+    //! Prefix increment operator, increments the referenced object
+    BasicGeneralTypeRef & operator++()
+        requires( !Const && (!ErrorPolicy::rejectAtCompileTime || (hasPrefixIncrementOperator<Types_&> || ...)) )
+    {
+        std::visit(
+            [](const auto * arg){
+                if constexpr( hasPrefixIncrementOperator<decltype(access(arg))> ){
+                    ++access(arg);
+                } else {
+                    ErrorPolicy::unsupported([]{
+                        return "Can not invoke prefix operator++ on held type ("
+                            + typeToString<std::remove_cvref_t<decltype(*arg)>>() + ")";
+                    });
+                }
+            },
+            obj_
+        );
+        return *this;
+    }
+
+    //! Postfix increment operator, increments the referenced object and returns its previous value
+    GenType operator++(int)
+        requires( !Const && (!ErrorPolicy::rejectAtCompileTime || (hasPostfixIncrementOperator<Types_&> || ...)) )
+    {
+        return std::visit(
+            [](const auto * arg) -> GenType {
+                if constexpr( hasPostfixIncrementOperator<decltype(access(arg))> ){
+                    return GenType(access(arg)++);
+                } else {
+                    ErrorPolicy::unsupported([]{
+                        return "Can not invoke postfix operator++ on held type ("
+                            + typeToString<std::remove_cvref_t<decltype(*arg)>>() + ")";
+                    });
+                }
+            },
+            obj_
+        );
+    }
+
+    //! Prefix decrement operator, decrements the referenced object
+    BasicGeneralTypeRef & operator--()
+        requires( !Const && (!ErrorPolicy::rejectAtCompileTime || (hasPrefixDecrementOperator<Types_&> || ...)) )
+    {
+        std::visit(
+            [](const auto * arg){
+                if constexpr( hasPrefixDecrementOperator<decltype(access(arg))> ){
+                    --access(arg);
+                } else {
+                    ErrorPolicy::unsupported([]{
+                        return "Can not invoke prefix operator-- on held type ("
+                            + typeToString<std::remove_cvref_t<decltype(*arg)>>() + ")";
+                    });
+                }
+            },
+            obj_
+        );
+        return *this;
+    }
+
+    //! Postfix decrement operator, decrements the referenced object and returns its previous value
+    GenType operator--(int)
+        requires( !Const && (!ErrorPolicy::rejectAtCompileTime || (hasPostfixDecrementOperator<Types_&> || ...)) )
+    {
+        return std::visit(
+            [](const auto * arg) -> GenType {
+                if constexpr( hasPostfixDecrementOperator<decltype(access(arg))> ){
+                    return GenType(access(arg)--);
+                } else {
+                    ErrorPolicy::unsupported([]{
+                        return "Can not invoke postfix operator-- on held type ("
+                            + typeToString<std::remove_cvref_t<decltype(*arg)>>() + ")";
+                    });
+                }
+            },
+            obj_
+        );
+    }
+
+    //! Access operator, references the element of the referenced object. The element has to be
+    //! an l-value of one of the types, e.g. a `double` in a `std::vector<double>`.
+    template<typename Key>
+        requires( !ErrorPolicy::rejectAtCompileTime || (isReferenceable<Access<Types_>,const Key &>() || ...) )
+    BasicGeneralTypeRef operator[](const Key & key) const {
+        return std::visit(
+            [&key](const auto * arg) -> BasicGeneralTypeRef {
+                if constexpr( isReferenceable<decltype(access(arg)),const Key &>() ){
+                    using Element = std::remove_cvref_t<decltype(access(arg)[key])>;
+                    return BasicGeneralTypeRef(std::in_place_index<indexOf<Element>>, &access(arg)[key]);
+                } else {
+                    ErrorPolicy::unsupported([]{
+                        return "Can not reference the result of operator[] on held type ("
+                            + typeToString<std::remove_cvref_t<decltype(*arg)>>() + ")";
+                    });
+                }
+            },
+            obj_
+        );
+    }
+
+    // =========================================================================================
+    // Binary Operators
+    // =========================================================================================
+    // The operands of a binary operator are a reference and a GeneralType, another reference or one of the
+    // types. The operators are declared for the reference on the left and for the other operands on the left.
+
+    //! Addition operator, forwards to the addition operator of the referenced objects
+    template<typename Rhs> requires( isOperand<Rhs> && declaresBinary<AdditionOperator> )
+    friend GenType operator+(const BasicGeneralTypeRef & lhs, const Rhs & rhs){ return binaryOperator<AdditionOperator>(lhs,rhs); }
+    template<typename Lhs> requires( isOperand<Lhs> && !isGeneralTypeRef<Lhs,GenType> && declaresBinary<AdditionOperator> )
+    friend GenType operator+(const Lhs & lhs, const BasicGeneralTypeRef & rhs){ return binaryOperator<AdditionOperator>(lhs,rhs); }
+
+    //! Subtraction operator, forwards to the subtraction operator of the referenced objects
+    template<typename Rhs> requires( isOperand<Rhs> && declaresBinary<SubtractionOperator> )
+    friend GenType operator-(const BasicGeneralTypeRef & lhs, const Rhs & rhs){ return binaryOperator<SubtractionOperator>(lhs,rhs); }
+    template<typename Lhs> requires( isOperand<Lhs> && !isGeneralTypeRef<Lhs,GenType> && declaresBinary<SubtractionOperator> )
+    friend GenType operator-(const Lhs & lhs, const BasicGeneralTypeRef & rhs){ return binaryOperator<SubtractionOperator>(lhs,rhs); }
+
+    //! Multiplication operator, forwards to the multiplication operator of the referenced objects
+    template<typename Rhs> requires( isOperand<Rhs> && declaresBinary<MultiplicationOperator> )
+    friend GenType operator*(const BasicGeneralTypeRef & lhs, const Rhs & rhs){ return binaryOperator<MultiplicationOperator>(lhs,rhs); }
+    template<typename Lhs> requires( isOperand<Lhs> && !isGeneralTypeRef<Lhs,GenType> && declaresBinary<MultiplicationOperator> )
+    friend GenType operator*(const Lhs & lhs, const BasicGeneralTypeRef & rhs){ return binaryOperator<MultiplicationOperator>(lhs,rhs); }
+
+    //! Division operator, forwards to the division operator of the referenced objects
+    template<typename Rhs> requires( isOperand<Rhs> && declaresBinary<DivisionOperator> )
+    friend GenType operator/(const BasicGeneralTypeRef & lhs, const Rhs & rhs){ return binaryOperator<DivisionOperator>(lhs,rhs); }
+    template<typename Lhs> requires( isOperand<Lhs> && !isGeneralTypeRef<Lhs,GenType> && declaresBinary<DivisionOperator> )
+    friend GenType operator/(const Lhs & lhs, const BasicGeneralTypeRef & rhs){ return binaryOperator<DivisionOperator>(lhs,rhs); }
+
+    //! Modulus operator, forwards to the modulus operator of the referenced objects
+    template<typename Rhs> requires( isOperand<Rhs> && declaresBinary<ModulusOperator> )
+    friend GenType operator%(const BasicGeneralTypeRef & lhs, const Rhs & rhs){ return binaryOperator<ModulusOperator>(lhs,rhs); }
+    template<typename Lhs> requires( isOperand<Lhs> && !isGeneralTypeRef<Lhs,GenType> && declaresBinary<ModulusOperator> )
+    friend GenType operator%(const Lhs & lhs, const BasicGeneralTypeRef & rhs){ return binaryOperator<ModulusOperator>(lhs,rhs); }
+
+    //! Bitwise AND operator, forwards to the bitwise AND operator of the referenced objects
+    template<typename Rhs> requires( isOperand<Rhs> && declaresBinary<BitwiseAndOperator> )
+    friend GenType operator&(const BasicGeneralTypeRef & lhs, const Rhs & rhs){ return binaryOperator<BitwiseAndOperator>(lhs,rhs); }
+    template<typename Lhs> requires( isOperand<Lhs> && !isGeneralTypeRef<Lhs,GenType> && declaresBinary<BitwiseAndOperator> )
+    friend GenType operator&(const Lhs & lhs, const BasicGeneralTypeRef & rhs){ return binaryOperator<BitwiseAndOperator>(lhs,rhs); }
+
+    //! Logical AND operator, forwards to the logical AND operator of the referenced objects
+    template<typename Rhs> requires( isOperand<Rhs> && declaresBinary<LogicalAndOperator> )
+    friend GenType operator&&(const BasicGeneralTypeRef & lhs, const Rhs & rhs){ return binaryOperator<LogicalAndOperator>(lhs,rhs); }
+    template<typename Lhs> requires( isOperand<Lhs> && !isGeneralTypeRef<Lhs,GenType> && declaresBinary<LogicalAndOperator> )
+    friend GenType operator&&(const Lhs & lhs, const BasicGeneralTypeRef & rhs){ return binaryOperator<LogicalAndOperator>(lhs,rhs); }
+
+    //! Exclusive Or operator, forwards to the exclusive or operator of the referenced objects
+    template<typename Rhs> requires( isOperand<Rhs> && declaresBinary<ExclusiveOrOperator> )
+    friend GenType operator^(const BasicGeneralTypeRef & lhs, const Rhs & rhs){ return binaryOperator<ExclusiveOrOperator>(lhs,rhs); }
+    template<typename Lhs> requires( isOperand<Lhs> && !isGeneralTypeRef<Lhs,GenType> && declaresBinary<ExclusiveOrOperator> )
+    friend GenType operator^(const Lhs & lhs, const BasicGeneralTypeRef & rhs){ return binaryOperator<ExclusiveOrOperator>(lhs,rhs); }
+
+    //! Bitwise inclusive Or operator, forwards to the bitwise inclusive or operator of the referenced objects
+    template<typename Rhs> requires( isOperand<Rhs> && declaresBinary<BitwiseInclusiveOrOperator> )
+    friend GenType operator|(const BasicGeneralTypeRef & lhs, const Rhs & rhs){ return binaryOperator<BitwiseInclusiveOrOperator>(lhs,rhs); }
+    template<typename Lhs> requires( isOperand<Lhs> && !isGeneralTypeRef<Lhs,GenType> && declaresBinary<BitwiseInclusiveOrOperator> )
+    friend GenType operator|(const Lhs & lhs, const BasicGeneralTypeRef & rhs){ return binaryOperator<BitwiseInclusiveOrOperator>(lhs,rhs); }
+
+    //! Logical inclusive Or operator, forwards to the logical inclusive or operator of the referenced objects
+    template<typename Rhs> requires( isOperand<Rhs> && declaresBinary<LogicalInclusiveOrOperator> )
+    friend GenType operator||(const BasicGeneralTypeRef & lhs, const Rhs & rhs){ return binaryOperator<LogicalInclusiveOrOperator>(lhs,rhs); }
+    template<typename Lhs> requires( isOperand<Lhs> && !isGeneralTypeRef<Lhs,GenType> && declaresBinary<LogicalInclusiveOrOperator> )
+    friend GenType operator||(const Lhs & lhs, const BasicGeneralTypeRef & rhs){ return binaryOperator<LogicalInclusiveOrOperator>(lhs,rhs); }
+
+    //! Comparison smaller operator, forwards to the smaller comparison operator of the referenced objects
+    template<typename Rhs> requires( isOperand<Rhs> && declaresBinary<SmallerComparisonOperator> )
+    friend GenType operator<(const BasicGeneralTypeRef & lhs, const Rhs & rhs){ return binaryOperator<SmallerComparisonOperator>(lhs,rhs); }
+    template<typename Lhs> requires( isOperand<Lhs> && !isGeneralTypeRef<Lhs,GenType> && declaresBinary<SmallerComparisonOperator> )
+    friend GenType operator<(const Lhs & lhs, const BasicGeneralTypeRef & rhs){ return binaryOperator<SmallerComparisonOperator>(lhs,rhs); }
+
+    //! Comparison larger operator, forwards to the larger comparison operator of the referenced objects
+    template<typename Rhs> requires( isOperand<Rhs> && declaresBinary<LargerComparisonOperator> )
+    friend GenType operator>(const BasicGeneralTypeRef & lhs, const Rhs & rhs){ return binaryOperator<LargerComparisonOperator>(lhs,rhs); }
+    template<typename Lhs> requires( isOperand<Lhs> && !isGeneralTypeRef<Lhs,GenType> && declaresBinary<LargerComparisonOperator> )
+    friend GenType operator>(const Lhs & lhs, const BasicGeneralTypeRef & rhs){ return binaryOperator<LargerComparisonOperator>(lhs,rhs); }
+
+    //! Comparison smaller equal operator, forwards to the smaller equal comparison operator of the referenced objects
+    template<typename Rhs> requires( isOperand<Rhs> && declaresBinary<SmallerEqualComparisonOperator> )
+    friend GenType operator<=(const BasicGeneralTypeRef & lhs, const Rhs & rhs){ return binaryOperator<SmallerEqualComparisonOperator>(lhs,rhs); }
+    template<typename Lhs> requires( isOperand<Lhs> && !isGeneralTypeRef<Lhs,GenType> && declaresBinary<SmallerEqualComparisonOperator> )
+    friend GenType operator<=(const Lhs & lhs, const BasicGeneralTypeRef & rhs){ return binaryOperator<SmallerEqualComparisonOperator>(lhs,rhs); }
+
+    //! Comparison larger equal operator, forwards to the larger equal comparison operator of the referenced objects
+    template<typename Rhs> requires( isOperand<Rhs> && declaresBinary<LargerEqualComparisonOperator> )
+    friend GenType operator>=(const BasicGeneralTypeRef & lhs, const Rhs & rhs){ return binaryOperator<LargerEqualComparisonOperator>(lhs,rhs); }
+    template<typename Lhs> requires( isOperand<Lhs> && !isGeneralTypeRef<Lhs,GenType> && declaresBinary<LargerEqualComparisonOperator> )
+    friend GenType operator>=(const Lhs & lhs, const BasicGeneralTypeRef & rhs){ return binaryOperator<LargerEqualComparisonOperator>(lhs,rhs); }
+
+    //! Comparison Equality operator, forwards to the equality comparison operator of the referenced objects
+    template<typename Rhs> requires( isOperand<Rhs> && declaresBinary<EqualityComparisonOperator> )
+    friend GenType operator==(const BasicGeneralTypeRef & lhs, const Rhs & rhs){ return binaryOperator<EqualityComparisonOperator>(lhs,rhs); }
+    template<typename Lhs> requires( isOperand<Lhs> && !isGeneralTypeRef<Lhs,GenType> && declaresBinary<EqualityComparisonOperator> )
+    friend GenType operator==(const Lhs & lhs, const BasicGeneralTypeRef & rhs){ return binaryOperator<EqualityComparisonOperator>(lhs,rhs); }
+
+    //! Comparison Inequality operator, forwards to the inequality comparison operator of the referenced objects
+    template<typename Rhs> requires( isOperand<Rhs> && declaresBinary<InequalityComparisonOperator> )
+    friend GenType operator!=(const BasicGeneralTypeRef & lhs, const Rhs & rhs){ return binaryOperator<InequalityComparisonOperator>(lhs,rhs); }
+    template<typename Lhs> requires( isOperand<Lhs> && !isGeneralTypeRef<Lhs,GenType> && declaresBinary<InequalityComparisonOperator> )
+    friend GenType operator!=(const Lhs & lhs, const BasicGeneralTypeRef & rhs){ return binaryOperator<InequalityComparisonOperator>(lhs,rhs); }
+
+    // =========================================================================================
+    // Compound Assignment Operators
+    // =========================================================================================
+    // The compound assignments modify the referenced object in place and return the reference.
+
+    //! Addition assignment operator, forwards to the addition assignment operator of the referenced objects
+    template<typename Rhs> requires( !Const && isOperand<Rhs> && declaresAssignment<AddAssignmentOperator> )
+    BasicGeneralTypeRef & operator+=(const Rhs & rhs){ return assignmentOperator<AddAssignmentOperator>(rhs); }
+
+    //! Subtraction assignment operator, forwards to the subtraction assignment operator of the referenced objects
+    template<typename Rhs> requires( !Const && isOperand<Rhs> && declaresAssignment<SubtractAssignmentOperator> )
+    BasicGeneralTypeRef & operator-=(const Rhs & rhs){ return assignmentOperator<SubtractAssignmentOperator>(rhs); }
+
+    //! Multiplication assignment operator, forwards to the multiplication assignment operator of the referenced objects
+    template<typename Rhs> requires( !Const && isOperand<Rhs> && declaresAssignment<MultiplyAssignmentOperator> )
+    BasicGeneralTypeRef & operator*=(const Rhs & rhs){ return assignmentOperator<MultiplyAssignmentOperator>(rhs); }
+
+    //! Division assignment operator, forwards to the division assignment operator of the referenced objects
+    template<typename Rhs> requires( !Const && isOperand<Rhs> && declaresAssignment<DivisionAssignmentOperator> )
+    BasicGeneralTypeRef & operator/=(const Rhs & rhs){ return assignmentOperator<DivisionAssignmentOperator>(rhs); }
+
+    //! Modulus assignment operator, forwards to the modulus assignment operator of the referenced objects
+    template<typename Rhs> requires( !Const && isOperand<Rhs> && declaresAssignment<ModulusAssignmentOperator> )
+    BasicGeneralTypeRef & operator%=(const Rhs & rhs){ return assignmentOperator<ModulusAssignmentOperator>(rhs); }
+
+    //! Bitwise AND assignment operator, forwards to the bitwise AND assignment operator of the referenced objects
+    template<typename Rhs> requires( !Const && isOperand<Rhs> && declaresAssignment<BitwiseAndAssignmentOperator> )
+    BasicGeneralTypeRef & operator&=(const Rhs & rhs){ return assignmentOperator<BitwiseAndAssignmentOperator>(rhs); }
+
+    //! Bitwise Inclusive OR assignment operator, forwards to the bitwise inclusive or assignment operator of the referenced objects
+    template<typename Rhs> requires( !Const && isOperand<Rhs> && declaresAssignment<BitwiseInclusiveOrAssignmentOperator> )
+    BasicGeneralTypeRef & operator|=(const Rhs & rhs){ return assignmentOperator<BitwiseInclusiveOrAssignmentOperator>(rhs); }
+
+    //! Exclusive OR assignment operator, forwards to the exclusive or assignment operator of the referenced objects
+    template<typename Rhs> requires( !Const && isOperand<Rhs> && declaresAssignment<ExclusiveOrAssignmentOperator> )
+    BasicGeneralTypeRef & operator^=(const Rhs & rhs){ return assignmentOperator<ExclusiveOrAssignmentOperator>(rhs); }
+
+    //! Right shift assignment operator, forwards to the right shift assignment operator of the referenced objects
+    template<typename Rhs> requires( !Const && isOperand<Rhs> && declaresAssignment<RightShiftAssignmentOperator> )
+    BasicGeneralTypeRef & operator>>=(const Rhs & rhs){ return assignmentOperator<RightShiftAssignmentOperator>(rhs); }
+
+    //! Left shift assignment operator, forwards to the left shift assignment operator of the referenced objects
+    template<typename Rhs> requires( !Const && isOperand<Rhs> && declaresAssignment<LeftShiftAssignmentOperator> )
+    BasicGeneralTypeRef & operator<<=(const Rhs & rhs){ return assignmentOperator<LeftShiftAssignmentOperator>(rhs); }
+
+    protected:
+    template<typename, bool> friend class BasicGeneralTypeRef;
+
+    //! Reference the object `pointer` of the alternative `Index`
+    template<std::size_t Index, typename Type>
+    BasicGeneralTypeRef(std::in_place_index_t<Index> index, Type * pointer) :
+        obj_(index, pointer)
+    {}
+
+    //! The referenced object `*pointer` as it is accessed through this reference
+    template<typename Type>
+    static Access<Type> access(const Type * pointer){
+        if constexpr( Const ){
+            return *pointer;
+        } else {
+            return const_cast<Type &>(*pointer);
+        }
+    }
+
+    //! Table entry of `pointersOf`, points to the alternative `Index` of a GeneralType
+    template<std::size_t Index>
+    static Variant pointerEntry(const typename GenType::Variant & var){
+        return Variant(std::in_place_index<Index>, std::get_if<Index>(&var));
+    }
+
+    template<std::size_t ... Indices>
+    static constexpr auto makePointerTable(std::index_sequence<Indices...>){
+        using Entry = Variant (*)(const typename GenType::Variant &);
+        return std::array<Entry, sizeof...(Indices)>{ &pointerEntry<Indices>... };
+    }
+
+    //! Pointer to the object of `operand`, a GeneralType, a reference or one of the types
+    template<typename Operand>
+    static Variant pointersOf(const Operand & operand){
+        if constexpr( std::is_same_v<Operand,GenType> ){
+            static constexpr auto table = makePointerTable(std::make_index_sequence<numberOfAlternatives>{});
+            if( operand.obj_.valueless_by_exception() ) [[unlikely]] {
+                throw std::bad_variant_access();
+            }
+            return table[operand.obj_.index()](operand.obj_);
+        } else if constexpr( isGeneralTypeRef<Operand,GenType> ){
+            return operand.obj_;
+        } else {
+            return Variant(std::in_place_index<indexOf<Operand>>, &operand);
+        }
+    }
+
+    // The operators dispatch through a flat table with one function pointer per pair of alternatives, like
+    // the operators of the GeneralType. All pairs an operator is not defined for point to the same error entry.
+
+    //! Table entry of a binary operator, applies `Operation` to the alternatives `LhsIndex` and `RhsIndex`
+    template<typename Operation, std::size_t LhsIndex, std::size_t RhsIndex>
+    static GenType binaryEntry(const Variant & lhs, const Variant & rhs){
+        return GenType(Operation::apply(**std::get_if<LhsIndex>(&lhs), **std::get_if<RhsIndex>(&rhs)));
+    }
+
+    //! Shared table entry of all pairs of alternatives an operator is not defined for
+    template<typename Operation, typename Result>
+    [[noreturn]] static Result unsupportedEntry(const Variant & lhs, const Variant & rhs){
+        ErrorPolicy::unsupported([&lhs,&rhs]{
+            return "Can not invoke " + std::string(Operation::name) + " on held types ("
+                + GenType::alternativeName(lhs.index()) + " and "
+                + GenType::alternativeName(rhs.index()) + ")";
+        });
+    }
+
+    //! Select the table entry of a binary operator for the alternatives `LhsIndex` and `RhsIndex`
+    template<typename Operation, std::size_t LhsIndex, std::size_t RhsIndex>
+    static constexpr auto selectBinaryEntry(){
+        using LhsType = decltype(**std::get_if<LhsIndex>(std::declval<const Variant *>()));
+        using RhsType = decltype(**std::get_if<RhsIndex>(std::declval<const Variant *>()));
+        if constexpr ( GenType::template isDispatchable<Operation,LhsType,RhsType>() ){
+            return &binaryEntry<Operation,LhsIndex,RhsIndex>;
+        } else {
+            return &unsupportedEntry<Operation,GenType>;
+        }
+    }
+
+    template<typename Operation, std::size_t ... Indices>
+    static constexpr auto makeBinaryTable(std::index_sequence<Indices...>){
+        using Entry = GenType (*)(const Variant &, const Variant &);
+        return std::array<Entry, sizeof...(Indices)>{
+            selectBinaryEntry<Operation, Indices / numberOfAlternatives, Indices % numberOfAlternatives>()...
+        };
+    }
+
+    //! Forwards a binary operator to the objects of `lhs` and `rhs`, which are not copied
+    template<typename Operation, typename Lhs, typename Rhs>
+    static GenType binaryOperator(const Lhs & lhs, const Rhs & rhs){
+        static constexpr auto table = makeBinaryTable<Operation>(
+            std::make_index_sequence<numberOfAlternatives * numberOfAlternatives>{}
+        );
+        const Variant lhsPointers = pointersOf(lhs);
+        const Variant rhsPointers = pointersOf(rhs);
+        return table[lhsPointers.index() * numberOfAlternatives + rhsPointers.index()](lhsPointers, rhsPointers);
+    }
+
+    //! Table entry of an assignment operator, applies `Operation` to the alternatives `LhsIndex` and `RhsIndex`
+    template<typename Operation, std::size_t LhsIndex, std::size_t RhsIndex>
+    static void assignmentEntry(const Variant & lhs, const Variant & rhs){
+        Operation::apply(access(*std::get_if<LhsIndex>(&lhs)), **std::get_if<RhsIndex>(&rhs));
+    }
+
+    //! Select the table entry of an assignment operator for the alternatives `LhsIndex` and `RhsIndex`
+    template<typename Operation, std::size_t LhsIndex, std::size_t RhsIndex>
+    static constexpr auto selectAssignmentEntry(){
+        using LhsType = decltype(access(*std::get_if<LhsIndex>(std::declval<const Variant *>())));
+        using RhsType = decltype(**std::get_if<RhsIndex>(std::declval<const Variant *>()));
+        if constexpr ( Operation::template isSupported<LhsType,RhsType> ){
+            return &assignmentEntry<Operation,LhsIndex,RhsIndex>;
+        } else {
+            return &unsupportedEntry<Operation,void>;
+        }
+    }
+
+    template<typename Operation, std::size_t ... Indices>
+    static constexpr auto makeAssignmentTable(std::index_sequence<Indices...>){
+        using Entry = void (*)(const Variant &, const Variant &);
+        return std::array<Entry, sizeof...(Indices)>{
+            selectAssignmentEntry<Operation, Indices / numberOfAlternatives, Indices % numberOfAlternatives>()...
+        };
+    }
+
+    //! Forwards an assignment operator to the referenced object and the object of `rhs`
+    template<typename Operation, typename Rhs>
+    BasicGeneralTypeRef & assignmentOperator(const Rhs & rhs){
+        static constexpr auto table = makeAssignmentTable<Operation>(
+            std::make_index_sequence<numberOfAlternatives * numberOfAlternatives>{}
+        );
+        const Variant rhsPointers = pointersOf(rhs);
+        table[obj_.index() * numberOfAlternatives + rhsPointers.index()](obj_, rhsPointers);
+        return *this;
+    }
+
+    //! Pointer to the referenced object
+    Variant obj_;
+}; // BasicGeneralTypeRef<GenType,Const>
+
+//! A reference to an object of one of the types of `GenType`, which modifies the referenced object
+template<typename GenType>
+using GeneralTypeRef = BasicGeneralTypeRef<GenType,false>;
+
+//! A read only reference to an object of one of the types of `GenType`
+template<typename GenType>
+using GeneralTypeView = BasicGeneralTypeRef<GenType,true>;
+
+//! Reference the object held by `genT`
+template<typename ErrorPolicy, typename ... Types_>
+GeneralTypeRef<BasicGeneralType<ErrorPolicy,Types_...>> borrow(BasicGeneralType<ErrorPolicy,Types_...> & genT){
+    return GeneralTypeRef<BasicGeneralType<ErrorPolicy,Types_...>>(genT);
+}
+
+//! Reference the object held by `genT` read only
+template<typename ErrorPolicy, typename ... Types_>
+GeneralTypeView<BasicGeneralType<ErrorPolicy,Types_...>> borrow(const BasicGeneralType<ErrorPolicy,Types_...> & genT){
+    return GeneralTypeView<BasicGeneralType<ErrorPolicy,Types_...>>(genT);
+}
+
+//! Temporaries can not be borrowed, the reference would dangle
+template<typename ErrorPolicy, typename ... Types_>
+void borrow(const BasicGeneralType<ErrorPolicy,Types_...> && genT) = delete;
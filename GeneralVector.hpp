@@ -0,0 +1,504 @@
+#pragma once
+
+#include "GeneralType.hpp"
+
+#include<tuple>
+#include<algorithm>
+#include<initializer_list>
+#include<stdexcept>
+
+/*!
+ * A columnar container of `GeneralType`s.
+ * Instead of storing one `std::variant` per element, every alternative has its own typed array
+ * (column). The elements are indexed by runs: consecutive elements that hold the same alternative
+ * and are stored contiguously in its column. Thus a million doubles take the space of a million
+ * doubles plus a single run and bulk operators dispatch once per run instead of per element.
+ *
+ * Element access returns `GeneralType`s (or a proxy that can be assigned to), assigning a value
+ * of a different alternative splits the run of the element. The old value of the element stays
+ * in its column until `shrink_to_fit` is called.
+ */
+template<typename ErrorPolicy, typename ... Types_>
+class BasicGeneralVector{
+    public:
+    //! The type of a single element
+    using value_type = BasicGeneralType<ErrorPolicy, Types_...>;
+
+    protected:
+    //! The variant held by a single element
+    using Variant = typename value_type::Variant;
+
+    //! Number of alternatives, i.e. the number of columns
+    static constexpr std::size_t numberOfAlternatives = std::variant_size_v<Variant>;
+
+    //! A run of consecutive elements holding the same alternative stored contiguously in its column
+    struct Run {
+        //! Index of the first element of the run
+        std::size_t begin;
+        //! Number of elements in the run
+        std::size_t count;
+        //! Position of the first element of the run in the column of its alternative
+        std::size_t offset;
+        //! Index of the held alternative
+        std::size_t alternative;
+    };
+
+    public:
+    //! A proxy to an element, that converts to `value_type` and can be assigned to
+    class Reference {
+        public:
+        //! Read the element
+        template<typename Type>
+            requires( std::is_constructible_v<Type,value_type> )
+        operator Type() const {
+            return static_cast<Type>(vector_->get(index_));
+        }
+
+        //! Assign a new value to the element
+        Reference & operator=(const value_type & value){
+            vector_->set(index_,value);
+            return *this;
+        }
+
+        //! Assign the value of another element
+        Reference & operator=(const Reference & other){
+            return *this = other.vector_->get(other.index_);
+        }
+
+        //! Put the content of the element to the out stream `os`
+        friend std::ostream & operator<<(std::ostream & os, const Reference & ref){
+            return os << ref.vector_->get(ref.index_);
+        }
+
+        private:
+        friend class BasicGeneralVector;
+
+        Reference(BasicGeneralVector * vector, std::size_t index) :
+            vector_(vector), index_(index)
+        {}
+
+        BasicGeneralVector * vector_;
+        std::size_t index_;
+    };
+
+    //! Default-construct an empty `GeneralVector`
+    BasicGeneralVector() = default;
+
+    //! Construct a `GeneralVector` from a list of elements
+    BasicGeneralVector(std::initializer_list<value_type> values){
+        for(const value_type & value: values){
+            push_back(value);
+        }
+    }
+
+    //! Number of elements
+    std::size_t size() const { return size_; }
+
+    //! Check if there are no elements
+    bool empty() const { return size_ == 0; }
+
+    //! Number of runs, i.e. the number of dispatches of a bulk operator
+    std::size_t numberOfRuns() const { return runs_.size(); }
+
+    //! Remove all elements
+    void clear(){
+        std::apply([](auto & ... columns){ (columns.clear(), ...); }, columns_);
+        runs_.clear();
+        size_ = 0;
+    }
+
+    //! Append the content of a `GeneralType`
+    void push_back(const value_type & value){
+        std::visit(
+            [this](const auto & arg){
+                using Type = std::remove_cvref_t<decltype(arg)>;
+                this->appendToColumn<indexOfType<Type, long int, Types_...>()>(arg);
+            },
+            value.obj_
+        );
+    }
+
+    //! Append an object of one of the types `Types_` directly to its column
+    template<typename Type>
+        requires( (std::is_same_v<std::remove_cvref_t<Type>,Types_> || ...) )
+    void push_back(Type && value){
+        appendToColumn<indexOfType<std::remove_cvref_t<Type>, long int, Types_...>()>(std::forward<Type>(value));
+    }
+
+    //! Construct an object of type `Type` in place at the end of its column
+    template<typename Type, typename ... Args>
+        requires( (std::is_same_v<Type,Types_> || ...) )
+    void emplace_back(Args && ... args){
+        constexpr std::size_t alternative = indexOfType<Type, long int, Types_...>();
+        auto & column = std::get<alternative>(columns_);
+        column.emplace_back(std::forward<Args>(args)...);
+        appendRun(alternative, column.size()-1, 1);
+    }
+
+    //! Read the element at `index`
+    value_type get(std::size_t index) const {
+        static constexpr auto table = makeGetTable(std::make_index_sequence<numberOfAlternatives>{});
+        const Run & run = findRun(index);
+        return table[run.alternative](*this, run.offset + (index - run.begin));
+    }
+
+    //! Assign `value` to the element at `index`
+    void set(std::size_t index, const value_type & value){
+        auto run = runs_.begin() + (&findRun(index) - runs_.data());
+        std::visit(
+            [this,&run,index](const auto & arg){
+                using Type = std::remove_cvref_t<decltype(arg)>;
+                constexpr std::size_t alternative = indexOfType<Type, long int, Types_...>();
+                auto & column = std::get<alternative>(columns_);
+
+                // Same alternative: overwrite in place
+                if( run->alternative == alternative ){
+                    column[run->offset + (index - run->begin)] = arg;
+                    return;
+                }
+
+                // Different alternative: append to its column and split the run
+                column.push_back(arg);
+                const Run old = *run;
+                const std::size_t position = index - old.begin;
+                Run split[3];
+                std::size_t numberOfSplits = 0;
+                if( position > 0 ){
+                    split[numberOfSplits++] = Run{old.begin, position, old.offset, old.alternative};
+                }
+                split[numberOfSplits++] = Run{index, 1, column.size()-1, alternative};
+                if( position + 1 < old.count ){
+                    split[numberOfSplits++] = Run{
+                        index+1, old.count-position-1, old.offset+position+1, old.alternative
+                    };
+                }
+                run = runs_.erase(run);
+                runs_.insert(run, split, split + numberOfSplits);
+            },
+            value.obj_
+        );
+    }
+
+    //! Read the element at `index`
+    value_type operator[](std::size_t index) const { return get(index); }
+
+    //! Access the element at `index` through an assignable proxy
+    Reference operator[](std::size_t index){ return Reference(this,index); }
+
+    //! Release the values that were overwritten by values of a different alternative
+    //! and merge the runs as far as possible
+    void shrink_to_fit(){
+        BasicGeneralVector compacted;
+        static constexpr auto table = makeCopyTable(std::make_index_sequence<numberOfAlternatives>{});
+        for(const Run & run: runs_){
+            table[run.alternative](*this, run.offset, run.count, compacted);
+        }
+        std::apply([](auto & ... columns){ (columns.shrink_to_fit(), ...); }, compacted.columns_);
+        compacted.runs_.shrink_to_fit();
+        *this = std::move(compacted);
+    }
+
+    // =========================================================================================
+    // Bulk Operators
+    // =========================================================================================
+    // The element wise operators dispatch once per pair of overlapping runs and then apply
+    // the operator of the held types in a tight loop over the columns.
+
+    //! Element wise addition
+    friend BasicGeneralVector operator+(const BasicGeneralVector & lhs, const BasicGeneralVector & rhs){ return elementwise<AdditionOperator>(lhs,rhs); }
+    friend BasicGeneralVector operator+(const BasicGeneralVector & lhs, const value_type & rhs){ return broadcast<AdditionOperator,false>(lhs,rhs); }
+    friend BasicGeneralVector operator+(const value_type & lhs, const BasicGeneralVector & rhs){ return broadcast<AdditionOperator,true>(rhs,lhs); }
+
+    //! Element wise subtraction
+    friend BasicGeneralVector operator-(const BasicGeneralVector & lhs, const BasicGeneralVector & rhs){ return elementwise<SubtractionOperator>(lhs,rhs); }
+    friend BasicGeneralVector operator-(const BasicGeneralVector & lhs, const value_type & rhs){ return broadcast<SubtractionOperator,false>(lhs,rhs); }
+    friend BasicGeneralVector operator-(const value_type & lhs, const BasicGeneralVector & rhs){ return broadcast<SubtractionOperator,true>(rhs,lhs); }
+
+    //! Element wise multiplication
+    friend BasicGeneralVector operator*(const BasicGeneralVector & lhs, const BasicGeneralVector & rhs){ return elementwise<MultiplicationOperator>(lhs,rhs); }
+    friend BasicGeneralVector operator*(const BasicGeneralVector & lhs, const value_type & rhs){ return broadcast<MultiplicationOperator,false>(lhs,rhs); }
+    friend BasicGeneralVector operator*(const value_type & lhs, const BasicGeneralVector & rhs){ return broadcast<MultiplicationOperator,true>(rhs,lhs); }
+
+    //! Element wise division
+    friend BasicGeneralVector operator/(const BasicGeneralVector & lhs, const BasicGeneralVector & rhs){ return elementwise<DivisionOperator>(lhs,rhs); }
+    friend BasicGeneralVector operator/(const BasicGeneralVector & lhs, const value_type & rhs){ return broadcast<DivisionOperator,false>(lhs,rhs); }
+    friend BasicGeneralVector operator/(const value_type & lhs, const BasicGeneralVector & rhs){ return broadcast<DivisionOperator,true>(rhs,lhs); }
+
+    //! Element wise modulus
+    friend BasicGeneralVector operator%(const BasicGeneralVector & lhs, const BasicGeneralVector & rhs){ return elementwise<ModulusOperator>(lhs,rhs); }
+    friend BasicGeneralVector operator%(const BasicGeneralVector & lhs, const value_type & rhs){ return broadcast<ModulusOperator,false>(lhs,rhs); }
+    friend BasicGeneralVector operator%(const value_type & lhs, const BasicGeneralVector & rhs){ return broadcast<ModulusOperator,true>(rhs,lhs); }
+
+    //! Element wise smaller comparison
+    friend BasicGeneralVector operator<(const BasicGeneralVector & lhs, const BasicGeneralVector & rhs){ return elementwise<SmallerComparisonOperator>(lhs,rhs); }
+    friend BasicGeneralVector operator<(const BasicGeneralVector & lhs, const value_type & rhs){ return broadcast<SmallerComparisonOperator,false>(lhs,rhs); }
+    friend BasicGeneralVector operator<(const value_type & lhs, const BasicGeneralVector & rhs){ return broadcast<SmallerComparisonOperator,true>(rhs,lhs); }
+
+    //! Element wise larger comparison
+    friend BasicGeneralVector operator>(const BasicGeneralVector & lhs, const BasicGeneralVector & rhs){ return elementwise<LargerComparisonOperator>(lhs,rhs); }
+    friend BasicGeneralVector operator>(const BasicGeneralVector & lhs, const value_type & rhs){ return broadcast<LargerComparisonOperator,false>(lhs,rhs); }
+    friend BasicGeneralVector operator>(const value_type & lhs, const BasicGeneralVector & rhs){ return broadcast<LargerComparisonOperator,true>(rhs,lhs); }
+
+    //! Element wise smaller equal comparison
+    friend BasicGeneralVector operator<=(const BasicGeneralVector & lhs, const BasicGeneralVector & rhs){ return elementwise<SmallerEqualComparisonOperator>(lhs,rhs); }
+    friend BasicGeneralVector operator<=(const BasicGeneralVector & lhs, const value_type & rhs){ return broadcast<SmallerEqualComparisonOperator,false>(lhs,rhs); }
+    friend BasicGeneralVector operator<=(const value_type & lhs, const BasicGeneralVector & rhs){ return broadcast<SmallerEqualComparisonOperator,true>(rhs,lhs); }
+
+    //! Element wise larger equal comparison
+    friend BasicGeneralVector operator>=(const BasicGeneralVector & lhs, const BasicGeneralVector & rhs){ return elementwise<LargerEqualComparisonOperator>(lhs,rhs); }
+    friend BasicGeneralVector operator>=(const BasicGeneralVector & lhs, const value_type & rhs){ return broadcast<LargerEqualComparisonOperator,false>(lhs,rhs); }
+    friend BasicGeneralVector operator>=(const value_type & lhs, const BasicGeneralVector & rhs){ return broadcast<LargerEqualComparisonOperator,true>(rhs,lhs); }
+
+    //! Element wise equality comparison
+    friend BasicGeneralVector operator==(const BasicGeneralVector & lhs, const BasicGeneralVector & rhs){ return elementwise<EqualityComparisonOperator>(lhs,rhs); }
+    friend BasicGeneralVector operator==(const BasicGeneralVector & lhs, const value_type & rhs){ return broadcast<EqualityComparisonOperator,false>(lhs,rhs); }
+    friend BasicGeneralVector operator==(const value_type & lhs, const BasicGeneralVector & rhs){ return broadcast<EqualityComparisonOperator,true>(rhs,lhs); }
+
+    //! Element wise inequality comparison
+    friend BasicGeneralVector operator!=(const BasicGeneralVector & lhs, const BasicGeneralVector & rhs){ return elementwise<InequalityComparisonOperator>(lhs,rhs); }
+    friend BasicGeneralVector operator!=(const BasicGeneralVector & lhs, const value_type & rhs){ return broadcast<InequalityComparisonOperator,false>(lhs,rhs); }
+    friend BasicGeneralVector operator!=(const value_type & lhs, const BasicGeneralVector & rhs){ return broadcast<InequalityComparisonOperator,true>(rhs,lhs); }
+
+    protected:
+
+    //! Append `count` elements of the alternative `alternative` stored at `offset` in its column
+    void appendRun(std::size_t alternative, std::size_t offset, std::size_t count){
+        if( !runs_.empty()
+            && runs_.back().alternative == alternative
+            && runs_.back().offset + runs_.back().count == offset ){
+            runs_.back().count += count;
+        } else {
+            runs_.push_back(Run{size_, count, offset, alternative});
+        }
+        size_ += count;
+    }
+
+    //! Append a single value to the column of the alternative `Alternative`
+    template<std::size_t Alternative, typename Value>
+    void appendToColumn(Value && value){
+        auto & column = std::get<Alternative>(columns_);
+        column.push_back(std::forward<Value>(value));
+        appendRun(Alternative, column.size()-1, 1);
+    }
+
+    //! Find the run containing the element at `index`
+    const Run & findRun(std::size_t index) const {
+        if( index >= size_ ){
+            throw std::out_of_range(
+                "GeneralVector index " + std::to_string(index)
+                + " out of range for size " + std::to_string(size_)
+            );
+        }
+        return *(std::upper_bound(
+            runs_.begin(), runs_.end(), index,
+            [](std::size_t i, const Run & run){ return i < run.begin; }
+        ) - 1);
+    }
+
+    //! Table entry of `get`, read the element at `offset` in the column of `Alternative`
+    template<std::size_t Alternative>
+    static value_type getEntry(const BasicGeneralVector & vector, std::size_t offset){
+        return value_type(std::get<Alternative>(vector.columns_)[offset]);
+    }
+
+    template<std::size_t ... Alternatives>
+    static constexpr auto makeGetTable(std::index_sequence<Alternatives...>){
+        using Entry = value_type (*)(const BasicGeneralVector &, std::size_t);
+        return std::array<Entry, sizeof...(Alternatives)>{ &getEntry<Alternatives>... };
+    }
+
+    //! Table entry of `shrink_to_fit`, copy a run of the alternative `Alternative` to `target`
+    template<std::size_t Alternative>
+    static void copyEntry(const BasicGeneralVector & source, std::size_t offset, std::size_t count, BasicGeneralVector & target){
+        const auto & sourceColumn = std::get<Alternative>(source.columns_);
+        auto & targetColumn = std::get<Alternative>(target.columns_);
+        const std::size_t begin = targetColumn.size();
+        targetColumn.insert(targetColumn.end(), sourceColumn.begin() + offset, sourceColumn.begin() + offset + count);
+        target.appendRun(Alternative, begin, count);
+    }
+
+    template<std::size_t ... Alternatives>
+    static constexpr auto makeCopyTable(std::index_sequence<Alternatives...>){
+        using Entry = void (*)(const BasicGeneralVector &, std::size_t, std::size_t, BasicGeneralVector &);
+        return std::array<Entry, sizeof...(Alternatives)>{ &copyEntry<Alternatives>... };
+    }
+
+    //! Store `count` results of `Operation` in `result`, `lhs(k)` and `rhs(k)` provide the operands.
+    //! Results of one of the alternatives are written directly into their column.
+    template<typename Operation, typename LhsAccess, typename RhsAccess>
+    static void storeResults(std::size_t count, LhsAccess lhs, RhsAccess rhs, BasicGeneralVector & result){
+        using ResultType = std::remove_cvref_t<decltype(Operation::apply(lhs(0),rhs(0)))>;
+        constexpr std::size_t alternative = indexOfType<ResultType, long int, Types_...>();
+
+        if constexpr( alternative < numberOfAlternatives ){
+            auto & column = std::get<alternative>(result.columns_);
+            const std::size_t begin = column.size();
+            column.resize(begin + count);
+            auto out = column.begin() + begin;
+            for(std::size_t k = 0; k < count; ++k){
+                out[k] = Operation::apply(lhs(k),rhs(k));
+            }
+            result.appendRun(alternative, begin, count);
+        } else {
+            for(std::size_t k = 0; k < count; ++k){
+                result.push_back(value_type(Operation::apply(lhs(k),rhs(k))));
+            }
+        }
+    }
+
+    //! Report an operator that is not defined for the alternatives `lhs` and `rhs`
+    template<typename Operation>
+    [[noreturn]] static void unsupported(std::size_t lhs, std::size_t rhs){
+        ErrorPolicy::unsupported([lhs,rhs]{
+            return "Can not invoke element wise " + std::string(Operation::name) + " on held types ("
+                + value_type::alternativeName(lhs) + " and "
+                + value_type::alternativeName(rhs) + ")";
+        });
+    }
+
+    //! Table entry of an element wise operator on `count` elements of the alternatives `LhsAlternative` and `RhsAlternative`
+    template<typename Operation, std::size_t LhsAlternative, std::size_t RhsAlternative>
+    static void elementwiseEntry(
+        const BasicGeneralVector & lhs, std::size_t lhsOffset,
+        const BasicGeneralVector & rhs, std::size_t rhsOffset,
+        std::size_t count, BasicGeneralVector & result)
+    {
+        using LhsType = std::variant_alternative_t<LhsAlternative,Variant>;
+        using RhsType = std::variant_alternative_t<RhsAlternative,Variant>;
+        if constexpr( value_type::template isDispatchable<Operation,const LhsType &,const RhsType &>() ){
+            auto lhsColumn = std::get<LhsAlternative>(lhs.columns_).begin() + lhsOffset;
+            auto rhsColumn = std::get<RhsAlternative>(rhs.columns_).begin() + rhsOffset;
+            storeResults<Operation>(
+                count,
+                [&lhsColumn](std::size_t k) -> decltype(auto) { return lhsColumn[k]; },
+                [&rhsColumn](std::size_t k) -> decltype(auto) { return rhsColumn[k]; },
+                result
+            );
+        } else {
+            unsupported<Operation>(LhsAlternative,RhsAlternative);
+        }
+    }
+
+    template<typename Operation, std::size_t ... Indices>
+    static constexpr auto makeElementwiseTable(std::index_sequence<Indices...>){
+        using Entry = void (*)(
+            const BasicGeneralVector &, std::size_t, const BasicGeneralVector &, std::size_t,
+            std::size_t, BasicGeneralVector &
+        );
+        return std::array<Entry, sizeof...(Indices)>{
+            &elementwiseEntry<Operation, Indices / numberOfAlternatives, Indices % numberOfAlternatives>...
+        };
+    }
+
+    //! Apply `Operation` element wise, dispatching once per pair of overlapping runs
+    template<typename Operation>
+    static BasicGeneralVector elementwise(const BasicGeneralVector & lhs, const BasicGeneralVector & rhs){
+        static constexpr auto table = makeElementwiseTable<Operation>(
+            std::make_index_sequence<numberOfAlternatives * numberOfAlternatives>{}
+        );
+
+        if( lhs.size_ != rhs.size_ ){
+            throw std::runtime_error(
+                "Can not invoke element wise " + std::string(Operation::name)
+                + " on GeneralVectors of different size ("
+                + std::to_string(lhs.size_) + " and " + std::to_string(rhs.size_) + ")"
+            );
+        }
+
+        BasicGeneralVector result;
+        auto lhsRun = lhs.runs_.begin();
+        auto rhsRun = rhs.runs_.begin();
+        std::size_t position = 0;
+        while( position < lhs.size_ ){
+            const std::size_t lhsEnd = lhsRun->begin + lhsRun->count;
+            const std::size_t rhsEnd = rhsRun->begin + rhsRun->count;
+            const std::size_t count = std::min(lhsEnd,rhsEnd) - position;
+
+            table[lhsRun->alternative * numberOfAlternatives + rhsRun->alternative](
+                lhs, lhsRun->offset + (position - lhsRun->begin),
+                rhs, rhsRun->offset + (position - rhsRun->begin),
+                count, result
+            );
+
+            position += count;
+            if( position == lhsEnd ){ ++lhsRun; }
+            if( position == rhsEnd ){ ++rhsRun; }
+        }
+        return result;
+    }
+
+    //! Table entry of an operator between `count` elements of the alternative `VectorAlternative`
+    //! and a single value of the alternative `ScalarAlternative`
+    template<typename Operation, bool ScalarOnLeft, std::size_t VectorAlternative, std::size_t ScalarAlternative>
+    static void broadcastEntry(
+        const BasicGeneralVector & vector, std::size_t offset, std::size_t count,
+        const Variant & scalar, BasicGeneralVector & result)
+    {
+        using VectorType = std::variant_alternative_t<VectorAlternative,Variant>;
+        using ScalarType = std::variant_alternative_t<ScalarAlternative,Variant>;
+        using LhsType = std::conditional_t<ScalarOnLeft, ScalarType, VectorType>;
+        using RhsType = std::conditional_t<ScalarOnLeft, VectorType, ScalarType>;
+        if constexpr( value_type::template isDispatchable<Operation,const LhsType &,const RhsType &>() ){
+            auto column = std::get<VectorAlternative>(vector.columns_).begin() + offset;
+            const ScalarType & value = *std::get_if<ScalarAlternative>(&scalar);
+            auto vectorAccess = [&column](std::size_t k) -> decltype(auto) { return column[k]; };
+            auto scalarAccess = [&value](std::size_t) -> const ScalarType & { return value; };
+            if constexpr( ScalarOnLeft ){
+                storeResults<Operation>(count, scalarAccess, vectorAccess, result);
+            } else {
+                storeResults<Operation>(count, vectorAccess, scalarAccess, result);
+            }
+        } else if constexpr( ScalarOnLeft ){
+            unsupported<Operation>(ScalarAlternative,VectorAlternative);
+        } else {
+            unsupported<Operation>(VectorAlternative,ScalarAlternative);
+        }
+    }
+
+    template<typename Operation, bool ScalarOnLeft, std::size_t ... Indices>
+    static constexpr auto makeBroadcastTable(std::index_sequence<Indices...>){
+        using Entry = void (*)(
+            const BasicGeneralVector &, std::size_t, std::size_t, const Variant &, BasicGeneralVector &
+        );
+        return std::array<Entry, sizeof...(Indices)>{
+            &broadcastEntry<Operation, ScalarOnLeft, Indices / numberOfAlternatives, Indices % numberOfAlternatives>...
+        };
+    }
+
+    //! Apply `Operation` to every element and `scalar`, dispatching once per run
+    template<typename Operation, bool ScalarOnLeft>
+    static BasicGeneralVector broadcast(const BasicGeneralVector & vector, const value_type & scalar){
+        static constexpr auto table = makeBroadcastTable<Operation,ScalarOnLeft>(
+            std::make_index_sequence<numberOfAlternatives * numberOfAlternatives>{}
+        );
+
+        if( scalar.obj_.valueless_by_exception() ) [[unlikely]] {
+            throw std::bad_variant_access();
+        }
+
+        BasicGeneralVector result;
+        for(const Run & run: vector.runs_){
+            table[run.alternative * numberOfAlternatives + scalar.obj_.index()](
+                vector, run.offset, run.count, scalar.obj_, result
+            );
+        }
+        return result;
+    }
+
+    //! One column per alternative of the variant
+    std::tuple<std::vector<long int>, std::vector<Types_>...> columns_;
+
+    //! The runs of elements, sorted by their first element
+    std::vector<Run> runs_;
+
+    //! Number of elements
+    std::size_t size_ = 0;
+}; // BasicGeneralVector<ErrorPolicy,Types_...>
+
+//! A columnar container of `GeneralType<Types_...>`
+template<typename ... Types_>
+using GeneralVector = BasicGeneralVector<RuntimeErrorPolicy, Types_...>;
+
+//! A columnar container of `StrictGeneralType<Types_...>`
+template<typename ... Types_>
+using StrictGeneralVector = BasicGeneralVector<StrictErrorPolicy, Types_...>;
@@ -0,0 +1,902 @@
+#pragma once
+
+#include "GeneralDict.hpp"
+
+#include<algorithm>
+#include<array>
+#include<charconv>
+#include<cmath>
+#include<complex>
+#include<cstddef>
+#include<cstdint>
+#include<cstring>
+#include<istream>
+#include<iterator>
+#include<limits>
+#include<map>
+#include<ostream>
+#include<stdexcept>
+#include<string>
+#include<string_view>
+#include<type_traits>
+#include<vector>
+
+// Reads JSON documents into dictionaries of GeneralTypes in a single pass, without building a tree of
+// the document first. The members of the top level object become the entries of the dictionary, members
+// of nested objects are stored with their path as key, e.g. "solver.tolerance". The values are stored as
+//  - numbers without fraction and exponent as `int`, others (and integers exceeding an `int`) as `double`
+//  - `true` and `false` as `bool` and strings as `std::string`
+//  - arrays of numbers as `std::vector<int>` or `std::vector<double>`, arrays of booleans as `std::vector<bool>`
+//    and arrays of strings as `std::vector<std::string>`. Arrays of numbers are counted before they are read,
+//    such that every vector is allocated once.
+// If the GeneralType does not hold `int` or `double`, `long long` or `float` are used instead. Values the
+// GeneralType can not hold, `null`, nested and mixed arrays are rejected with a `std::runtime_error`.
+//
+// GeneralTypes and dictionaries are written to JSON by `std::to_chars`, without streams and independent of
+// the locale. Floating point numbers are written in the shortest form that reads back to the same value and
+// always with a fraction or an exponent, such that they are read back as floating point numbers. `std::complex`
+// is written as the array of its real and imaginary part, non-finite numbers as `null`.
+
+namespace {
+
+//! The first of `Candidates` contained in the list `Types`, `void` if none is contained
+template<typename Types, typename ... Candidates>
+struct FirstContained { using type = void; };
+
+template<typename ... Types, typename Candidate, typename ... Candidates>
+struct FirstContained<TypeList<Types...>, Candidate, Candidates...> {
+    using type = std::conditional_t<
+        (std::is_same_v<Candidate,Types> || ...),
+        Candidate,
+        typename FirstContained<TypeList<Types...>, Candidates...>::type
+    >;
+};
+
+//! Maximal nesting depth of objects in a JSON document
+constexpr std::size_t maximalJsonDepth = 256;
+
+} // namespace
+
+/*!
+ * Reads JSON text into GeneralTypes of type `GenType`. The types the JSON values are stored as are
+ * selected once at compile time from the types of `GenType`.
+ */
+template<typename GenType>
+class JsonParser;
+
+template<typename ErrorPolicy, typename ... Types_>
+class JsonParser<BasicGeneralType<ErrorPolicy,Types_...>> {
+    protected:
+    using GenType = BasicGeneralType<ErrorPolicy,Types_...>;
+
+    template<typename ... Candidates>
+    using FirstType = typename FirstContained<TypeList<Types_...>, Candidates...>::type;
+
+    //! The types JSON values are stored as, `void` if the GeneralType can not hold them
+    using Integer = FirstType<int, long long>;
+    using Floating = FirstType<double, float>;
+    using Boolean = FirstType<bool>;
+    using String = FirstType<std::string>;
+    using IntegerArray = FirstType<std::vector<int>, std::vector<long long>>;
+    using FloatingArray = FirstType<std::vector<double>, std::vector<float>>;
+    using BooleanArray = FirstType<std::vector<bool>>;
+    using StringArray = FirstType<std::vector<std::string>>;
+
+    public:
+    //! Read the JSON document `text`
+    explicit JsonParser(std::string_view text) :
+        begin_(text.data()), position_(text.data()), end_(text.data() + text.size())
+    {}
+
+    //! Read a document holding a single value
+    GenType parseValueDocument(){
+        skipWhitespace();
+        GenType value = parseValue();
+        expectEnd();
+        return value;
+    }
+
+    //! Read a document holding an object, its members are inserted into `dict` by `insert_or_assign`
+    template<typename Dict>
+    void parseObjectDocument(Dict & dict){
+        skipWhitespace();
+        expect('{');
+        std::string key;
+        parseMembers(dict, key, 1);
+        expectEnd();
+    }
+
+    protected:
+    //! Throw a `std::runtime_error` pointing to the current position
+    [[noreturn]] void fail(std::string_view message) const {
+        std::size_t line = 1, column = 1;
+        for(const char * c = begin_; c < position_; ++c){
+            if( *c == '\n' ){ ++line; column = 1; } else { ++column; }
+        }
+        throw std::runtime_error(
+            "Invalid JSON at line " + std::to_string(line) + ", column " + std::to_string(column) + ": " + std::string(message)
+        );
+    }
+
+    //! The current character, `'\0'` at the end of the text
+    char peek() const {
+        return position_ < end_ ? *position_ : '\0';
+    }
+
+    void skipWhitespace(){
+        while( position_ < end_ && (*position_ == ' ' || *position_ == '\n' || *position_ == '\r' || *position_ == '\t') ){
+            ++position_;
+        }
+    }
+
+    //! Skip the character `c`, which has to be the current character
+    void expect(char c){
+        if( peek() != c ){
+            fail(std::string("expected '") + c + "'");
+        }
+        ++position_;
+    }
+
+    //! Skip the literal `word`, which has to start at the current position
+    void expectWord(std::string_view word){
+        if( std::string_view(position_, std::size_t(end_ - position_)).substr(0, word.size()) != word ){
+            fail("expected " + std::string(word));
+        }
+        position_ += word.size();
+    }
+
+    void expectEnd(){
+        skipWhitespace();
+        if( position_ != end_ ){
+            fail("expected the end of the document");
+        }
+    }
+
+    static bool isDigit(char c){
+        return c >= '0' && c <= '9';
+    }
+
+    //! Read the members of an object, the opening brace is already read. Members of nested objects
+    //! get the key of the object and a dot as prefix, `key` holds the prefix of the current object.
+    template<typename Dict>
+    void parseMembers(Dict & dict, std::string & key, std::size_t depth){
+        if( depth > maximalJsonDepth ){
+            fail("objects are nested too deep");
+        }
+        skipWhitespace();
+        if( peek() == '}' ){
+            ++position_;
+            return;
+        }
+        while( true ){
+            const std::size_t prefixSize = key.size();
+            if( prefixSize > 0 ){ key += '.'; }
+            expect('"');
+            appendString(key);
+            skipWhitespace();
+            expect(':');
+            skipWhitespace();
+            if( peek() == '{' ){
+                ++position_;
+                parseMembers(dict, key, depth + 1);
+            } else {
+                dict.insert_or_assign(key, parseValue());
+            }
+            key.resize(prefixSize);
+
+            skipWhitespace();
+            if( peek() == ',' ){
+                ++position_;
+                skipWhitespace();
+            } else if( peek() == '}' ){
+                ++position_;
+                return;
+            } else {
+                fail("expected ',' or '}'");
+            }
+        }
+    }
+
+    //! Read a value other than an object
+    GenType parseValue(){
+        switch( peek() ){
+            case '"': {
+                if constexpr( !std::is_void_v<String> ){
+                    ++position_;
+                    std::string value;
+                    appendString(value);
+                    return GenType(std::move(value));
+                } else {
+                    fail("the GeneralType can not hold a string");
+                }
+            }
+            case 't':
+            case 'f': {
+                if constexpr( !std::is_void_v<Boolean> ){
+                    return GenType(parseBoolean());
+                } else {
+                    fail("the GeneralType can not hold a bool");
+                }
+            }
+            case '[':
+                ++position_;
+                return parseArray();
+            case 'n':
+                fail("null can not be held by a GeneralType");
+            case '{':
+                fail("objects are only supported as members of objects");
+            default:
+                if( peek() != '-' && !isDigit(peek()) ){
+                    fail("expected a value");
+                }
+                return parseNumber();
+        }
+    }
+
+    bool parseBoolean(){
+        if( peek() == 't' ){
+            expectWord("true");
+            return true;
+        }
+        expectWord("false");
+        return false;
+    }
+
+    //! Read a string, the opening quote is already read, and append its characters to `out`
+    void appendString(std::string & out){
+        while( true ){
+            // copy the characters up to the next quote, escape or control character at once
+            const char * chunk = position_;
+            while( position_ < end_ && *position_ != '"' && *position_ != '\\' && static_cast<unsigned char>(*position_) >= 0x20 ){
+                ++position_;
+            }
+            out.append(chunk, std::size_t(position_ - chunk));
+            if( position_ == end_ ){
+                fail("unterminated string");
+            }
+            if( *position_ == '"' ){
+                ++position_;
+                return;
+            }
+            if( *position_ != '\\' ){
+                fail("control character in string");
+            }
+            ++position_;
+            switch( peek() ){
+                case '"': out += '"'; break;
+                case '\\': out += '\\'; break;
+                case '/': out += '/'; break;
+                case 'b': out += '\b'; break;
+                case 'f': out += '\f'; break;
+                case 'n': out += '\n'; break;
+                case 'r': out += '\r'; break;
+                case 't': out += '\t'; break;
+                case 'u': {
+                    ++position_;
+                    appendCodePoint(out, parseCodePoint());
+                    continue;
+                }
+                default: fail("invalid escape sequence");
+            }
+            ++position_;
+        }
+    }
+
+    //! Read the 4 hexadecimal digits of a `\u` escape
+    std::uint32_t parseHex4(){
+        std::uint32_t value = 0;
+        if( end_ - position_ < 4 || std::from_chars(position_, position_ + 4, value, 16).ptr != position_ + 4 ){
+            fail("expected 4 hexadecimal digits");
+        }
+        position_ += 4;
+        return value;
+    }
+
+    //! Read the code point of a `\u` escape, including the low surrogate of a surrogate pair
+    std::uint32_t parseCodePoint(){
+        const std::uint32_t high = parseHex4();
+        if( high < 0xD800 || high > 0xDFFF ){
+            return high;
+        }
+        if( high > 0xDBFF ){
+            fail("unpaired low surrogate");
+        }
+        expectWord("\\u");
+        const std::uint32_t low = parseHex4();
+        if( low < 0xDC00 || low > 0xDFFF ){
+            fail("expected a low surrogate");
+        }
+        return 0x10000 + ((high - 0xD800) << 10) + (low - 0xDC00);
+    }
+
+    //! Append the UTF-8 encoding of `codePoint`
+    static void appendCodePoint(std::string & out, std::uint32_t codePoint){
+        if( codePoint < 0x80 ){
+            out += char(codePoint);
+        } else if( codePoint < 0x800 ){
+            out += char(0xC0 | (codePoint >> 6));
+            out += char(0x80 | (codePoint & 0x3F));
+        } else if( codePoint < 0x10000 ){
+            out += char(0xE0 | (codePoint >> 12));
+            out += char(0x80 | ((codePoint >> 6) & 0x3F));
+            out += char(0x80 | (codePoint & 0x3F));
+        } else {
+            out += char(0xF0 | (codePoint >> 18));
+            out += char(0x80 | ((codePoint >> 12) & 0x3F));
+            out += char(0x80 | ((codePoint >> 6) & 0x3F));
+            out += char(0x80 | (codePoint & 0x3F));
+        }
+    }
+
+    //! A number as scanned by `scanNumber`, its value is `(negative ? -1 : 1) * mantissa * 10^exponent`
+    //! if `isExact`, i.e. if the mantissa has at most 19 significant digits
+    struct ScannedNumber {
+        std::uint64_t mantissa = 0;
+        int exponent = 0;
+        bool negative = false;
+        bool isInteger = true;
+        bool isExact = true;
+    };
+
+    //! Skip a number following the JSON grammar and accumulate its decimal mantissa and exponent
+    ScannedNumber scanNumber(){
+        ScannedNumber number;
+        std::size_t significantDigits = 0;
+        const auto readDigits = [&](int exponentPerDigit){
+            if( position_ == end_ || !isDigit(*position_) ){
+                fail("expected a digit");
+            }
+            for(; position_ < end_ && isDigit(*position_); ++position_){
+                if( number.mantissa == 0 && *position_ == '0' ){
+                    number.exponent += exponentPerDigit;
+                } else if( ++significantDigits <= 19 ){
+                    number.mantissa = 10 * number.mantissa + std::uint64_t(*position_ - '0');
+                    number.exponent += exponentPerDigit;
+                } else {
+                    number.isExact = false;
+                }
+            }
+        };
+        if( peek() == '-' ){
+            ++position_;
+            number.negative = true;
+        }
+        if( peek() == '0' ){
+            ++position_;
+        } else {
+            readDigits(0);
+        }
+        if( peek() == '.' ){
+            ++position_;
+            readDigits(-1);
+            number.isInteger = false;
+        }
+        if( peek() == 'e' || peek() == 'E' ){
+            ++position_;
+            bool negativeExponent = peek() == '-';
+            if( peek() == '+' || peek() == '-' ){ ++position_; }
+            if( position_ == end_ || !isDigit(*position_) ){
+                fail("expected a digit");
+            }
+            int exponent = 0;
+            for(; position_ < end_ && isDigit(*position_); ++position_){
+                if( exponent < 100000 ){ exponent = 10 * exponent + (*position_ - '0'); }
+            }
+            number.exponent += negativeExponent ? -exponent : exponent;
+            number.isInteger = false;
+        }
+        return number;
+    }
+
+    //! Convert the number scanned from `first` to the current position to `Type`, returns false if it is out of range.
+    //! Integers of up to 19 digits and doubles that are the exact quotient or product of their mantissa and a power
+    //! of ten are computed from `number`, all others are converted with `std::from_chars`.
+    template<typename Type>
+    bool convertNumber(const char * first, const ScannedNumber & number, Type & value){
+        if constexpr( std::is_integral_v<Type> ){
+            if( number.isInteger && number.isExact ){
+                constexpr auto maximum = std::uint64_t(std::numeric_limits<Type>::max());
+                if( number.mantissa > maximum + number.negative ){
+                    return false;
+                }
+                value = number.negative ? Type(-std::int64_t(number.mantissa - 1) - 1) : Type(number.mantissa);
+                return true;
+            }
+        } else if constexpr( std::is_same_v<Type,double> ){
+            // both the mantissa and the power of ten are exact doubles, so the result is correctly rounded
+            if( number.isExact && number.mantissa <= (std::uint64_t(1) << 53) && number.exponent >= -22 && number.exponent <= 22 ){
+                constexpr double powersOfTen[] = {
+                    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+                };
+                value = double(number.mantissa);
+                value = number.exponent < 0 ? value / powersOfTen[-number.exponent] : value * powersOfTen[number.exponent];
+                value = number.negative ? -value : value;
+                return true;
+            }
+        }
+        const auto [end, error] = std::from_chars(first, position_, value);
+        if( error == std::errc::result_out_of_range ){
+            return false;
+        }
+        if( error != std::errc() || end != position_ ){
+            fail("invalid number");
+        }
+        return true;
+    }
+
+    //! Read a number as `Integer` or `Floating`
+    GenType parseNumber(){
+        const char * first = position_;
+        const ScannedNumber number = scanNumber();
+        if constexpr( !std::is_void_v<Integer> ){
+            Integer value;
+            if( number.isInteger && convertNumber(first, number, value) ){
+                return GenType(value);
+            }
+        }
+        if constexpr( !std::is_void_v<Floating> ){
+            Floating value;
+            if( !convertNumber(first, number, value) ){
+                fail("number out of range");
+            }
+            return GenType(value);
+        } else {
+            fail(number.isInteger ? "integer out of range" : "the GeneralType can not hold a floating point number");
+        }
+    }
+
+    //! Read an array, the opening bracket is already read. The type of the first element decides the type of the array.
+    GenType parseArray(){
+        skipWhitespace();
+        const char first = peek();
+        if( first == ']' ){
+            ++position_;
+            return emptyArray();
+        }
+        if( first == '"' ){
+            if constexpr( !std::is_void_v<StringArray> ){
+                StringArray values;
+                parseElements([&]{
+                    expectSameType(peek() == '"');
+                    ++position_;
+                    values.emplace_back();
+                    appendString(values.back());
+                });
+                return GenType(std::move(values));
+            } else {
+                fail("the GeneralType can not hold an array of strings");
+            }
+        }
+        if( first == 't' || first == 'f' ){
+            if constexpr( !std::is_void_v<BooleanArray> ){
+                BooleanArray values;
+                parseElements([&]{
+                    expectSameType(peek() == 't' || peek() == 'f');
+                    values.push_back(parseBoolean());
+                });
+                return GenType(std::move(values));
+            } else {
+                fail("the GeneralType can not hold an array of booleans");
+            }
+        }
+        if( first == '-' || isDigit(first) ){
+            return parseNumberArray();
+        }
+        fail(first == '[' || first == '{' ? "nested arrays and objects in arrays are not supported" : "expected a value");
+    }
+
+    //! An empty array, held by the first vector type of floating point numbers, integers, strings or booleans
+    GenType emptyArray(){
+        if constexpr( !std::is_void_v<FloatingArray> ){
+            return GenType(FloatingArray());
+        } else if constexpr( !std::is_void_v<IntegerArray> ){
+            return GenType(IntegerArray());
+        } else if constexpr( !std::is_void_v<StringArray> ){
+            return GenType(StringArray());
+        } else if constexpr( !std::is_void_v<BooleanArray> ){
+            return GenType(BooleanArray());
+        } else {
+            fail("the GeneralType can not hold an array");
+        }
+    }
+
+    //! Fail unless the next element of an array is of the type of the first one
+    void expectSameType(bool isSameType){
+        if( !isSameType ){
+            fail("the elements of an array have to be of the same type");
+        }
+    }
+
+    //! Call `parseElement` for every element of an array and read the separators and the closing bracket
+    template<typename ParseElement>
+    void parseElements(ParseElement && parseElement){
+        while( true ){
+            parseElement();
+            skipWhitespace();
+            if( peek() == ',' ){
+                ++position_;
+                skipWhitespace();
+            } else if( peek() == ']' ){
+                ++position_;
+                return;
+            } else {
+                fail("expected ',' or ']'");
+            }
+        }
+    }
+
+    //! Read an array of numbers into a vector allocated once. The array is scanned up to its closing bracket first,
+    //! which counts the elements and checks if all of them are integers that fit into an `int`.
+    GenType parseNumberArray(){
+        std::size_t count = 1;
+        bool isInteger = true;
+        std::size_t digits = 0;
+        for(const char * c = position_; c < end_ && *c != ']'; ++c){
+            if( *c == ',' ){
+                ++count;
+                digits = 0;
+            } else if( isDigit(*c) ){
+                // integers of up to 9 digits fit into an int
+                isInteger = isInteger && ++digits < 10;
+            } else if( *c == '.' || *c == 'e' || *c == 'E' ){
+                isInteger = false;
+            } else if( *c == '"' || *c == '[' || *c == '{' ){
+                // not an array of numbers, fails when the element is read
+                break;
+            }
+        }
+        if constexpr( !std::is_void_v<IntegerArray> ){
+            if( isInteger || std::is_void_v<FloatingArray> ){
+                return parseNumbers<IntegerArray>(count);
+            }
+        }
+        if constexpr( !std::is_void_v<FloatingArray> ){
+            return parseNumbers<FloatingArray>(count);
+        } else {
+            fail("the GeneralType can not hold an array of numbers");
+        }
+    }
+
+    //! Read the elements of an array of numbers into a `Vector` with capacity for `count` elements
+    template<typename Vector>
+    GenType parseNumbers(std::size_t count){
+        using Element = typename Vector::value_type;
+        Vector values;
+        values.reserve(count);
+        parseElements([&]{
+            expectSameType(peek() == '-' || isDigit(peek()));
+            const char * first = position_;
+            const ScannedNumber number = scanNumber();
+            if( std::is_integral_v<Element> && !number.isInteger ){
+                fail("expected an integer");
+            }
+            Element value;
+            if( !convertNumber(first, number, value) ){
+                fail("number out of range");
+            }
+            values.push_back(value);
+        });
+        return GenType(std::move(values));
+    }
+
+    const char * begin_;
+    const char * position_;
+    const char * end_;
+}; // JsonParser<GenType>
+
+namespace {
+
+//! Reads JSON documents into values of type `Value`
+template<typename Value>
+struct JsonDocumentReader;
+
+template<typename ErrorPolicy, typename ... Types_>
+struct JsonDocumentReader<BasicGeneralType<ErrorPolicy,Types_...>> {
+    using GenType = BasicGeneralType<ErrorPolicy,Types_...>;
+
+    static GenType read(std::string_view json){
+        return JsonParser<GenType>(json).parseValueDocument();
+    }
+};
+
+template<typename ErrorPolicy, bool StableOrder, typename ... Types_>
+struct JsonDocumentReader<BasicGeneralDict<ErrorPolicy,StableOrder,Types_...>> {
+    using GenType = BasicGeneralType<ErrorPolicy,Types_...>;
+    using Dict = BasicGeneralDict<ErrorPolicy,StableOrder,Types_...>;
+
+    static Dict read(std::string_view json){
+        Dict dict;
+        JsonParser<GenType>(json).parseObjectDocument(dict);
+        return dict;
+    }
+};
+
+template<typename ErrorPolicy, typename ... Types_, typename Compare, typename Allocator>
+struct JsonDocumentReader<std::map<std::string,BasicGeneralType<ErrorPolicy,Types_...>,Compare,Allocator>> {
+    using GenType = BasicGeneralType<ErrorPolicy,Types_...>;
+    using Dict = std::map<std::string,GenType,Compare,Allocator>;
+
+    static Dict read(std::string_view json){
+        Dict dict;
+        JsonParser<GenType>(json).parseObjectDocument(dict);
+        return dict;
+    }
+};
+
+} // namespace
+
+//! Read a `Value`, a `GeneralDict` or a `std::map<std::string,GenType>` from a JSON object or a GeneralType
+//! from any other JSON value. Throws a `std::runtime_error` if `json` is invalid or holds values the GeneralType
+//! can not hold. If a key occurs more than once the last value is kept.
+template<typename Value>
+Value fromJson(std::string_view json){
+    return JsonDocumentReader<Value>::read(json);
+}
+
+//! Read a `Value` from the JSON document in the rest of the stream `is`
+template<typename Value>
+Value readJson(std::istream & is){
+    const std::string json{std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>()};
+    return fromJson<Value>(json);
+}
+
+namespace {
+
+//! If `Type` can be written as JSON
+template<typename Type>
+constexpr bool isJsonWritable = std::is_arithmetic_v<Type>;
+
+template<typename Type>
+constexpr bool isJsonWritable<std::complex<Type>> = std::is_floating_point_v<Type>;
+
+template<>
+constexpr bool isJsonWritable<std::string> = true;
+
+template<typename Element>
+constexpr bool isJsonWritable<std::vector<Element>> = isJsonWritable<Element>;
+
+//! Maximal number of characters `std::to_chars` writes for a `Type` in its shortest form
+template<typename Type>
+constexpr std::size_t maximalCharacters = std::is_floating_point_v<Type>
+    ? 4 + std::numeric_limits<Type>::max_digits10 + 6  // sign, point, 'e', exponent sign and digits
+    : 1 + std::numeric_limits<Type>::digits10 + 1;
+
+} // namespace
+
+/*!
+ * Appends JSON text to a string supplied by the caller, which can be reused to avoid allocations.
+ */
+class JsonWriter {
+    public:
+    //! Append to `out`. If `indented`, every member of an object is written on its own line.
+    explicit JsonWriter(std::string & out, bool indented = false) : out_(out), indented_(indented) {}
+
+    void write(bool value){
+        out_ += value ? "true" : "false";
+    }
+
+    template<typename Type>
+        requires( std::is_arithmetic_v<Type> && !std::is_same_v<Type,bool> )
+    void write(Type value){
+        char buffer[maximalCharacters<Type>];
+        out_.append(buffer, writeNumber(buffer, value));
+    }
+
+    template<typename Type>
+    void write(const std::complex<Type> & value){
+        out_ += '[';
+        write(value.real());
+        out_ += ", ";
+        write(value.imag());
+        out_ += ']';
+    }
+
+    //! Write `value` as string, quotes, backslashes and control characters are escaped
+    void write(std::string_view value){
+        static constexpr char hexDigits[] = "0123456789abcdef";
+        out_ += '"';
+        while( !value.empty() ){
+            // copy the characters up to the next one to escape at once
+            std::size_t length = 0;
+            while( length < value.size() && !needsEscape(value[length]) ){ ++length; }
+            out_.append(value.data(), length);
+            if( length == value.size() ){
+                break;
+            }
+            const char c = value[length];
+            switch( c ){
+                case '"': out_ += "\\\""; break;
+                case '\\': out_ += "\\\\"; break;
+                case '\b': out_ += "\\b"; break;
+                case '\f': out_ += "\\f"; break;
+                case '\n': out_ += "\\n"; break;
+                case '\r': out_ += "\\r"; break;
+                case '\t': out_ += "\\t"; break;
+                default:
+                    out_ += "\\u00";
+                    out_ += hexDigits[(unsigned char)c >> 4];
+                    out_ += hexDigits[(unsigned char)c & 0xF];
+            }
+            value.remove_prefix(length + 1);
+        }
+        out_ += '"';
+    }
+
+    void write(const std::string & value){
+        write(std::string_view(value));
+    }
+
+    //! Write a vector of numbers into space reserved once for the longest possible text
+    template<typename Element>
+        requires( std::is_arithmetic_v<Element> && !std::is_same_v<Element,bool> )
+    void write(const std::vector<Element> & values){
+        const std::size_t start = out_.size();
+        out_.resize(start + 2 + values.size() * (maximalCharacters<Element> + 2));
+        char * position = out_.data() + start;
+        *position++ = '[';
+        for(std::size_t i = 0; i < values.size(); ++i){
+            if( i > 0 ){
+                *position++ = ',';
+                *position++ = ' ';
+            }
+            position += writeNumber(position, values[i]);
+        }
+        *position++ = ']';
+        out_.resize(std::size_t(position - out_.data()));
+    }
+
+    template<typename Vector>
+        requires( !std::is_arithmetic_v<typename Vector::value_type> || std::is_same_v<typename Vector::value_type,bool> )
+    void write(const Vector & values){
+        out_ += '[';
+        bool first = true;
+        for(const auto & value: values){
+            if( !first ){ out_ += ", "; }
+            first = false;
+            if constexpr( std::is_same_v<typename Vector::value_type,bool> ){
+                write(bool(value));
+            } else {
+                write(value);
+            }
+        }
+        out_ += ']';
+    }
+
+    //! Write the entries of a `GeneralDict` or a `std::map` of strings and GeneralTypes as object
+    template<typename Dict>
+    void writeObject(const Dict & dict);
+
+    protected:
+    static bool needsEscape(char c){
+        return c == '"' || c == '\\' || (unsigned char)c < 0x20;
+    }
+
+    //! Write `value` to `buffer`, which holds at least `maximalCharacters<Type>` characters, and return the length
+    template<typename Type>
+    static std::size_t writeNumber(char * buffer, Type value){
+        if constexpr( std::is_floating_point_v<Type> ){
+            if( !std::isfinite(value) ){
+                std::memcpy(buffer, "null", 4);
+                return 4;
+            }
+            char * end = std::to_chars(buffer, buffer + maximalCharacters<Type>, value).ptr;
+            // keep floating point numbers apart from integers when they are read back
+            if( std::find_if(buffer, end, [](char c){ return c == '.' || c == 'e'; }) == end ){
+                *end++ = '.';
+                *end++ = '0';
+            }
+            return std::size_t(end - buffer);
+        } else {
+            return std::size_t(std::to_chars(buffer, buffer + maximalCharacters<Type>, value).ptr - buffer);
+        }
+    }
+
+    std::string & out_;
+    bool indented_;
+}; // JsonWriter
+
+/*!
+ * Writes the GeneralTypes of type `GenType` as JSON. The held alternative is dispatched through a table
+ * with one entry per alternative.
+ */
+template<typename GenType>
+struct JsonFormat;
+
+template<typename ErrorPolicy, typename ... Types_>
+struct JsonFormat<BasicGeneralType<ErrorPolicy,Types_...>> {
+    using GenType = BasicGeneralType<ErrorPolicy,Types_...>;
+    using Variant = typename GenType::Variant;
+
+    static void write(JsonWriter & writer, const GenType & genT){
+        static constexpr auto table = makeWriteTable(std::make_index_sequence<GenType::numberOfAlternatives>{});
+        if( genT.obj_.valueless_by_exception() ) [[unlikely]] {
+            throw std::bad_variant_access();
+        }
+        table[genT.obj_.index()](writer, genT);
+    }
+
+    protected:
+    //! Table entry of `write` for the alternative `Index`
+    template<std::size_t Index>
+    static void writeEntry(JsonWriter & writer, const GenType & genT){
+        using Alternative = std::variant_alternative_t<Index,Variant>;
+        if constexpr( isJsonWritable<Alternative> ){
+            writer.write(*std::get_if<Index>(&genT.obj_));
+        } else {
+            ErrorPolicy::unsupported([]{
+                return "Can not write held type (" + GenType::alternativeName(Index) + ") as JSON";
+            });
+        }
+    }
+
+    template<std::size_t ... Indices>
+    static constexpr auto makeWriteTable(std::index_sequence<Indices...>){
+        using Entry = void (*)(JsonWriter &, const GenType &);
+        return std::array<Entry, sizeof...(Indices)>{ &writeEntry<Indices>... };
+    }
+};
+
+template<typename Dict>
+void JsonWriter::writeObject(const Dict & dict){
+    using GenType = typename Dict::mapped_type;
+    out_ += '{';
+    bool first = true;
+    for(const auto & [key,value]: dict){
+        if( !first ){ out_ += ','; }
+        out_ += indented_ ? "\n  " : (first ? "" : " ");
+        first = false;
+        write(std::string_view(key));
+        out_ += ": ";
+        JsonFormat<GenType>::write(*this, value);
+    }
+    if( indented_ && !first ){ out_ += '\n'; }
+    out_ += '}';
+}
+
+namespace {
+
+//! Writes GeneralTypes and dictionaries of GeneralTypes as JSON
+template<typename ErrorPolicy, typename ... Types_>
+void writeJsonDocument(JsonWriter & writer, const BasicGeneralType<ErrorPolicy,Types_...> & genT){
+    JsonFormat<BasicGeneralType<ErrorPolicy,Types_...>>::write(writer, genT);
+}
+
+template<typename ErrorPolicy, bool StableOrder, typename ... Types_>
+void writeJsonDocument(JsonWriter & writer, const BasicGeneralDict<ErrorPolicy,StableOrder,Types_...> & dict){
+    writer.writeObject(dict);
+}
+
+template<typename ErrorPolicy, typename ... Types_, typename Compare, typename Allocator>
+void writeJsonDocument(
+    JsonWriter & writer,
+    const std::map<std::string,BasicGeneralType<ErrorPolicy,Types_...>,Compare,Allocator> & dict)
+{
+    writer.writeObject(dict);
+}
+
+} // namespace
+
+//! Append the JSON text of `value`, a GeneralType, a `GeneralDict` or a `std::map<std::string,GenType>`, to `out`.
+//! If `indented`, every entry of a dictionary is written on its own line. Types that can not be written
+//! are reported by the error policy of the GeneralType.
+template<typename Value>
+void toJson(const Value & value, std::string & out, bool indented = false){
+    JsonWriter writer(out, indented);
+    writeJsonDocument(writer, value);
+}
+
+//! The JSON text of `value`, a GeneralType, a `GeneralDict` or a `std::map<std::string,GenType>`
+template<typename Value>
+std::string toJson(const Value & value, bool indented = false){
+    std::string out;
+    toJson(value, out, indented);
+    return out;
+}
+
+//! Write the JSON text of `value` to the stream `os`
+template<typename Value>
+void writeJson(std::ostream & os, const Value & value, bool indented = false){
+    const std::string json = toJson(value, indented);
+    os.write(json.data(), std::streamsize(json.size()));
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+// Allocators for the heap backed alternatives of a GeneralType, e.g. strings and vectors, that allocate from
+// a `std::pmr::memory_resource` chosen per scope. Use `ScopedString` and `ScopedVector<Type>` as types of the
+// GeneralType, then every object created while a `MemoryResourceScope` is alive allocates from its resource:
+// the objects stored in GeneralTypes, their copies and the results of the operators, which are created like
+// a copy of their operand. A monotonic arena therefore absorbs all allocations of a request and is freed at
+// once. Objects keep the resource they were created with and must not outlive it.
+
+//! The memory resource `ScopedAllocator`s created by the current thread allocate from
+inline std::pmr::memory_resource * & scopedMemoryResource() noexcept {
+    thread_local std::pmr::memory_resource * resource = std::pmr::get_default_resource();
+    return resource;
+}
+
+/*!
+ * Makes `resource` the memory resource of the current thread while the scope is alive. Scopes can be
+ * nested, the previous resource is restored when the scope ends.
+ */
+class MemoryResourceScope {
+    public:
+    explicit MemoryResourceScope(std::pmr::memory_resource & resource) noexcept :
+        previous_(scopedMemoryResource())
+    {
+        scopedMemoryResource() = &resource;
+    }
+
+    ~MemoryResourceScope(){
+        scopedMemoryResource() = previous_;
+    }
+
+    MemoryResourceScope(const MemoryResourceScope &) = delete;
+    MemoryResourceScope & operator=(const MemoryResourceScope &) = delete;
+
+    protected:
+    std::pmr::memory_resource * previous_;
+};
+
+/*!
+ * An allocator that allocates from the memory resource of the scope it was created in. Like a
+ * `std::pmr::polymorphic_allocator` it is never propagated on assignment, but copies of a container
+ * allocate from the resource of the current scope instead of the one of the copied container.
+ */
+template<typename Type>
+class ScopedAllocator {
+    public:
+    using value_type = Type;
+
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::false_type;
+    using propagate_on_container_swap = std::false_type;
+    using is_always_equal = std::false_type;
+
+    //! Allocate from the memory resource of the current scope
+    ScopedAllocator() noexcept :
+        resource_(scopedMemoryResource())
+    {}
+
+    explicit ScopedAllocator(std::pmr::memory_resource * resource) noexcept :
+        resource_(resource)
+    {}
+
+    template<typename Other>
+    ScopedAllocator(const ScopedAllocator<Other> & allocator) noexcept :
+        resource_(allocator.resource())
+    {}
+
+    Type * allocate(std::size_t size){
+        return static_cast<Type *>(resource_->allocate(size * sizeof(Type), alignof(Type)));
+    }
+
+    void deallocate(Type * pointer, std::size_t size) noexcept {
+        resource_->deallocate(pointer, size * sizeof(Type), alignof(Type));
+    }
+
+    //! Copies of containers allocate from the memory resource of the current scope
+    ScopedAllocator select_on_container_copy_construction() const noexcept {
+        return ScopedAllocator();
+    }
+
+    std::pmr::memory_resource * resource() const noexcept {
+        return resource_;
+    }
+
+    template<typename Other>
+    friend bool operator==(const ScopedAllocator & lhs, const ScopedAllocator<Other> & rhs) noexcept {
+        return lhs.resource_ == rhs.resource() || lhs.resource_->is_equal(*rhs.resource());
+    }
+
+    protected:
+    std::pmr::memory_resource * resource_;
+};
+
+//! A string allocating from the memory resource of the current scope
+using ScopedString = std::basic_string<char, std::char_traits<char>, ScopedAllocator<char>>;
+
+//! A vector allocating from the memory resource of the current scope
+template<typename Type>
+using ScopedVector = std::vector<Type, ScopedAllocator<Type>>;
@@ -0,0 +1,246 @@
+#pragma once
+
+#include "CompactGeneralType.hpp"
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <ostream>
+#include <stdexcept>
+#include <type_traits>
+#include <variant>
+
+// An 8 byte storage of the values held by GeneralTypes whose types are all scalars, e.g. `bool`, `int`
+// and `double`. A double is stored as its own bits, all other values are stored in the payload of a NaN
+// that is never produced by arithmetic: the upper 13 bits are set, the next 3 bits tag the type and the
+// lower 48 bits hold the value. Types of up to 4 bytes and object pointers are stored in the payload, the
+// internal `long int` alternative if it fits into 48 bits. NaNs are stored as a single quiet NaN.
+// A `NanBoxedGeneralType` is trivially copyable, its values are read by value: `get<Type>()` returns a
+// copy and converting it to its GeneralType never allocates. `DenseGeneralType<GenType>` selects it
+// at compile time if the types of `GenType` permit it and a `CompactGeneralType` otherwise.
+
+namespace {
+
+//! Checks if `Type` is stored in the payload of a `NanBoxedGeneralType`
+template<typename Type>
+constexpr bool isNanBoxPayload = (std::is_trivially_copyable_v<Type> && sizeof(Type) <= 4)
+    || (std::is_pointer_v<Type> && std::is_object_v<std::remove_pointer_t<Type>>);
+
+//! Checks if the types of `GenType` can be stored in a `NanBoxedGeneralType`
+template<typename GenType>
+constexpr bool isNanBoxable = false;
+
+// At most one `double` is stored as is, the internal `long int` and up to 6 other types are tagged
+template<typename ErrorPolicy, typename ... Types_>
+constexpr bool isNanBoxable<BasicGeneralType<ErrorPolicy,Types_...>> =
+    ((std::is_same_v<Types_,double> || isNanBoxPayload<Types_>) && ...)
+    && (std::is_same_v<Types_,double> + ... + 0) <= 1
+    && (!std::is_same_v<Types_,double> + ... + 0) <= 6;
+
+} // namespace
+
+//! An 8 byte storage of the values held by GeneralTypes of type `GenType`
+template<typename GenType>
+class BasicNanBoxedGeneralType;
+
+template<typename ErrorPolicy, typename ... Types_>
+class BasicNanBoxedGeneralType<BasicGeneralType<ErrorPolicy,Types_...>> {
+    protected:
+    using GenType = BasicGeneralType<ErrorPolicy,Types_...>;
+    using Variant = typename GenType::Variant;
+
+    static_assert(isNanBoxable<GenType>, "The types of the GeneralType can not be NaN-boxed");
+
+    static constexpr std::size_t numberOfAlternatives = GenType::numberOfAlternatives;
+
+    //! Index of the alternative `Type`, `numberOfAlternatives` if `Type` is no alternative
+    template<typename Type>
+    static constexpr std::size_t indexOf = indexOfType<Type, long int, Types_...>();
+
+    template<std::size_t Index>
+    using Alternative = std::variant_alternative_t<Index,Variant>;
+
+    //! Index of the `double` alternative, `numberOfAlternatives` if there is none
+    static constexpr std::size_t doubleIndex = indexOf<double>;
+
+    //! The bits all tagged values have set, the tag follows in the bits 48 to 50
+    static constexpr std::uint64_t tagMask = 0xFFF8'0000'0000'0000;
+    static constexpr std::uint64_t payloadMask = 0x0000'FFFF'FFFF'FFFF;
+    static constexpr int tagShift = 48;
+
+    //! All NaNs are stored as this quiet NaN, which has no tag
+    static constexpr std::uint64_t canonicalNaN = 0x7FF8'0000'0000'0000;
+
+    //! Tag of the alternative `Index`, 1 for the first alternative other than `double`, 2 for the second ...
+    static constexpr std::uint64_t tagOf(std::size_t index){
+        return index - (doubleIndex < index) + 1;
+    }
+
+    //! Index of the alternative tagged by `tag`
+    static constexpr std::size_t indexOfTag(std::uint64_t tag){
+        const std::size_t index = std::size_t(tag) - 1;
+        return index + (doubleIndex <= index);
+    }
+
+    public:
+    //! Holds the same value as a default constructed GeneralType
+    constexpr BasicNanBoxedGeneralType() noexcept :
+        bits_(tagMask | (tagOf(0) << tagShift))
+    {}
+
+    //! Store the value held by `genT`
+    BasicNanBoxedGeneralType(const GenType & genT){
+        static constexpr auto table = makeFromTable(std::make_index_sequence<numberOfAlternatives>{});
+        if( genT.obj_.valueless_by_exception() ) [[unlikely]] {
+            throw std::bad_variant_access();
+        }
+        table[genT.obj_.index()](*this, genT);
+    }
+
+    //! Store `value`, which has one of the types of `GenType`
+    template<typename Type>
+        requires( indexOf<Type> < numberOfAlternatives )
+    BasicNanBoxedGeneralType(const Type & value){
+        store<indexOf<Type>>(value);
+    }
+
+    //! Store `value`, a GeneralType or one of its types, instead of the current value
+    template<typename Type>
+        requires( std::is_same_v<Type,GenType> || indexOf<Type> < numberOfAlternatives )
+    BasicNanBoxedGeneralType & operator=(const Type & value){
+        return *this = BasicNanBoxedGeneralType(value);
+    }
+
+    //! A GeneralType holding the stored value
+    operator GenType() const {
+        static constexpr auto table = makeToTable(std::make_index_sequence<numberOfAlternatives>{});
+        return table[index()](*this);
+    }
+
+    //! Index of the type of the stored value, the same as in `GenType`
+    std::size_t index() const noexcept {
+        const std::uint64_t tag = (bits_ >> tagShift) & 0x7;
+        if( (bits_ & tagMask) != tagMask || tag == 0 ){
+            return doubleIndex;
+        }
+        return indexOfTag(tag);
+    }
+
+    //! Check if the stored value has the type `Type`
+    template<typename Type>
+    bool holds() const noexcept {
+        return index() == indexOf<Type>;
+    }
+
+    //! A copy of the stored value, throws a `std::bad_variant_access` if it has another type than `Type`
+    template<typename Type>
+        requires( indexOf<Type> < numberOfAlternatives )
+    Type get() const {
+        if( index() != indexOf<Type> ){
+            throw std::bad_variant_access();
+        }
+        return load<indexOf<Type>>();
+    }
+
+    //! The stored bits, equal bits hold equal values of the same type
+    std::uint64_t bits() const noexcept {
+        return bits_;
+    }
+
+    //! Write the stored value like the GeneralType holding it
+    friend std::ostream & operator<<(std::ostream & os, const BasicNanBoxedGeneralType & boxed){
+        return os << GenType(boxed);
+    }
+
+    protected:
+    //! Store `value` of the alternative `Index`
+    template<std::size_t Index>
+    void store(const Alternative<Index> & value){
+        using Type = Alternative<Index>;
+        std::uint64_t payload;
+        if constexpr( Index == doubleIndex ){
+            bits_ = std::isnan(value) ? canonicalNaN : std::bit_cast<std::uint64_t>(value);
+            return;
+        } else if constexpr( std::is_pointer_v<Type> ){
+            payload = std::uint64_t(reinterpret_cast<std::uintptr_t>(value));
+            if( payload > payloadMask ){
+                throw std::out_of_range("The pointer does not fit into the 48 bits of a NanBoxedGeneralType");
+            }
+        } else if constexpr( std::is_same_v<Type,long int> && Index == 0 ){
+            constexpr long int limit = static_cast<long int>(1) << (tagShift - 1);
+            if( value < -limit || value >= limit ){
+                throw std::out_of_range("The long int does not fit into the 48 bits of a NanBoxedGeneralType");
+            }
+            payload = std::uint64_t(value) & payloadMask;
+        } else {
+            std::uint32_t raw = 0;
+            std::memcpy(&raw, &value, sizeof(Type));
+            payload = raw;
+        }
+        bits_ = tagMask | (tagOf(Index) << tagShift) | payload;
+    }
+
+    //! Load the value of the alternative `Index`, which has to be the stored one
+    template<std::size_t Index>
+    Alternative<Index> load() const noexcept {
+        using Type = Alternative<Index>;
+        const std::uint64_t payload = bits_ & payloadMask;
+        if constexpr( Index == doubleIndex ){
+            return std::bit_cast<double>(bits_);
+        } else if constexpr( std::is_pointer_v<Type> ){
+            return reinterpret_cast<Type>(std::uintptr_t(payload));
+        } else if constexpr( std::is_same_v<Type,long int> && Index == 0 ){
+            // sign extend the 48 bits
+            return static_cast<long int>(payload << (64 - tagShift)) >> (64 - tagShift);
+        } else {
+            const std::uint32_t raw = std::uint32_t(payload);
+            Type value;
+            std::memcpy(&value, &raw, sizeof(Type));
+            return value;
+        }
+    }
+
+    //! Table entry of the constructor from a GeneralType for the alternative `Index`
+    template<std::size_t Index>
+    static void fromEntry(BasicNanBoxedGeneralType & target, const GenType & genT){
+        target.template store<Index>(*std::get_if<Index>(&genT.obj_));
+    }
+
+    template<std::size_t ... Indices>
+    static constexpr auto makeFromTable(std::index_sequence<Indices...>){
+        using Entry = void (*)(BasicNanBoxedGeneralType &, const GenType &);
+        return std::array<Entry, sizeof...(Indices)>{ &fromEntry<Indices>... };
+    }
+
+    //! Table entry of the conversion to a GeneralType for the alternative `Index`
+    template<std::size_t Index>
+    static GenType toEntry(const BasicNanBoxedGeneralType & boxed){
+        GenType genT;
+        genT.obj_.template emplace<Index>(boxed.template load<Index>());
+        return genT;
+    }
+
+    template<std::size_t ... Indices>
+    static constexpr auto makeToTable(std::index_sequence<Indices...>){
+        using Entry = GenType (*)(const BasicNanBoxedGeneralType &);
+        return std::array<Entry, sizeof...(Indices)>{ &toEntry<Indices>... };
+    }
+
+    //! A double or a tagged NaN holding another type
+    std::uint64_t bits_;
+}; // BasicNanBoxedGeneralType<GenType>
+
+//! An 8 byte storage of the values held by a `GeneralType<Types_...>` of scalar types
+template<typename ... Types_>
+using NanBoxedGeneralType = BasicNanBoxedGeneralType<GeneralType<Types_...>>;
+
+//! The densest storage of the values held by GeneralTypes of type `GenType`: a `BasicNanBoxedGeneralType`
+//! if its types can be NaN-boxed, a `BasicCompactGeneralType` otherwise
+template<typename GenType>
+using DenseGeneralType = std::conditional_t<
+    isNanBoxable<GenType>,
+    BasicNanBoxedGeneralType<GenType>,
+    BasicCompactGeneralType<GenType>
+>;
@@ -0,0 +1,631 @@
+#pragma once
+
+#include "BinaryFormat.hpp"
+
+#include<cerrno>
+#include<iterator>
+#include<map>
+#include<memory>
+#include<optional>
+#include<span>
+#include<string>
+#include<string_view>
+#include<system_error>
+
+#include<fcntl.h>
+#include<sys/mman.h>
+#include<sys/stat.h>
+#include<unistd.h>
+
+// A snapshot stores a dictionary of GeneralTypes such that it is read in place, e.g. from a memory mapped
+// file, without decoding it first. Snapshots are only written and read on little endian platforms. The layout is
+//  - the header: the magic bytes, the version of the binary format, the kind of the document (snapshot), a hash
+//    of the types of the GeneralType (see BinaryFormat.hpp), the number of entries and the number of slots
+//  - the index: a hash table of slots, each a fingerprint of the hash of a key and the index of its entry,
+//    with the same hash function and linear probing as `GeneralDict`
+//  - the entries: the offset and size of the key and the value and the index of the held alternative
+//  - the data: the keys and values, every value starts at a multiple of 8 bytes
+// Arithmetic types and `std::complex` are stored as their raw bytes, strings as their characters and vectors
+// of arithmetic types and `std::complex` as a raw array. Other alternatives, e.g. `std::vector<bool>`, are
+// stored as their payload in the binary format and decoded when they are read.
+
+namespace {
+
+//! Kind of the document of a snapshot, next to the kinds of `BinaryDocument`
+constexpr std::uint8_t snapshotDocument = 2;
+
+//! Alignment of the tables and values of a snapshot
+constexpr std::size_t snapshotAlignment = 8;
+
+//! Header of a snapshot
+struct SnapshotHeader {
+    char magic[4];
+    std::uint32_t version;
+    std::uint8_t kind;
+    std::uint8_t reserved[7];
+    std::uint64_t typeListHash;
+    std::uint64_t numberOfEntries;
+    std::uint64_t numberOfSlots;
+};
+
+//! A slot of the index of a snapshot
+struct SnapshotSlot {
+    std::uint32_t fingerprint;
+    std::uint32_t entry;
+};
+
+//! Entry of an empty slot
+constexpr std::uint32_t snapshotEmptySlot = std::numeric_limits<std::uint32_t>::max();
+
+//! An entry of a snapshot, offsets are counted from the start of the snapshot and sizes in bytes
+struct SnapshotEntry {
+    std::uint64_t keyOffset;
+    std::uint64_t valueOffset;
+    std::uint64_t valueSize;
+    std::uint32_t keySize;
+    std::uint8_t alternative;
+    std::uint8_t reserved[3];
+};
+
+static_assert(sizeof(SnapshotHeader) == 40 && sizeof(SnapshotSlot) == 8 && sizeof(SnapshotEntry) == 32);
+
+//! Checks if a value of type `Type` is stored as its raw bytes in a snapshot
+template<typename Type>
+constexpr bool isSnapshotScalar = isBinaryEncodable<Type> && (std::is_arithmetic_v<Type> || isComplex<Type>);
+
+//! Checks if a vector of type `Type` is stored as a raw array in a snapshot
+template<typename Type>
+constexpr bool isSnapshotArray = false;
+
+template<typename Element>
+constexpr bool isSnapshotArray<std::vector<Element>> = isBlockEncodable<Element>;
+
+//! The type a value of type `Type` is read as from a snapshot: strings are read as `std::string_view`
+//! and raw arrays as `std::span`, which refer to the snapshot, all other types are copied
+template<typename Type>
+struct SnapshotAccess { using type = Type; };
+
+template<>
+struct SnapshotAccess<std::string> { using type = std::string_view; };
+
+template<typename Element>
+    requires( isBlockEncodable<Element> )
+struct SnapshotAccess<std::vector<Element>> { using type = std::span<const Element>; };
+
+//! Smallest power of two of at least 8 slots `count` entries fit into, the index is filled up to 3/4
+inline std::size_t snapshotSlotsFor(std::size_t count){
+    std::size_t numberOfSlots = 8;
+    while( count * 4 > numberOfSlots * 3 ){ numberOfSlots *= 2; }
+    return numberOfSlots;
+}
+
+//! A read only memory mapping of a whole file
+class MappedFile {
+    public:
+    explicit MappedFile(const std::string & path){
+        const int descriptor = ::open(path.c_str(), O_RDONLY);
+        if( descriptor < 0 ){
+            throw std::system_error(errno, std::generic_category(), "Can not open " + path);
+        }
+        struct stat status;
+        if( ::fstat(descriptor, &status) != 0 ){
+            const int error = errno;
+            ::close(descriptor);
+            throw std::system_error(error, std::generic_category(), "Can not read the size of " + path);
+        }
+        size_ = std::size_t(status.st_size);
+        if( size_ > 0 ){
+            void * data = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, descriptor, 0);
+            if( data == MAP_FAILED ){
+                const int error = errno;
+                ::close(descriptor);
+                throw std::system_error(error, std::generic_category(), "Can not map " + path);
+            }
+            data_ = static_cast<const std::byte *>(data);
+        }
+        // the mapping stays valid after the file is closed
+        ::close(descriptor);
+    }
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile & operator=(const MappedFile &) = delete;
+
+    ~MappedFile(){
+        if( data_ ){
+            ::munmap(const_cast<std::byte *>(data_), size_);
+        }
+    }
+
+    //! The mapped bytes, page aligned
+    std::span<const std::byte> bytes() const {
+        return {data_, size_};
+    }
+
+    protected:
+    const std::byte * data_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+} // namespace
+
+/*!
+ * Writes and reads the values of GeneralTypes of type `GenType` in a snapshot. The held alternative is
+ * dispatched through a table with one entry per alternative.
+ */
+template<typename ErrorPolicy, typename ... Types_>
+struct SnapshotFormat<BasicGeneralType<ErrorPolicy,Types_...>> {
+    using GenType = BasicGeneralType<ErrorPolicy,Types_...>;
+    using Variant = typename GenType::Variant;
+
+    static constexpr std::size_t numberOfAlternatives = GenType::numberOfAlternatives;
+    static_assert(numberOfAlternatives <= 256, "A snapshot stores the index of the alternative in a single byte");
+
+    //! Index of the alternative `Type`, `numberOfAlternatives` if `Type` is no alternative
+    template<typename Type>
+    static constexpr std::size_t indexOf = indexOfType<Type, long int, Types_...>();
+
+    //! Append the value held by `genT` and return the index of the held alternative
+    static std::size_t encode(BinaryEncoder & encoder, const GenType & genT){
+        static constexpr auto table = makeEncodeTable(std::make_index_sequence<numberOfAlternatives>{});
+        if( genT.obj_.valueless_by_exception() ) [[unlikely]] {
+            throw std::bad_variant_access();
+        }
+        table[genT.obj_.index()](encoder, genT);
+        return genT.obj_.index();
+    }
+
+    //! Read a value of the alternative `Type` from the `size` bytes at `data`
+    template<typename Type>
+    static typename SnapshotAccess<Type>::type read(const std::byte * data, std::size_t size){
+        if constexpr( isSnapshotScalar<Type> ){
+            if( size != sizeof(Type) ){
+                throw std::runtime_error("Invalid size of a " + binaryTypeName<Type>() + " in the snapshot");
+            }
+            if constexpr( std::is_same_v<Type,bool> ){
+                return std::to_integer<std::uint8_t>(*data) != 0;
+            } else {
+                Type value;
+                std::memcpy(&value, data, sizeof(Type));
+                return value;
+            }
+        } else if constexpr( std::is_same_v<Type,std::string> ){
+            return std::string_view(reinterpret_cast<const char *>(data), size);
+        } else if constexpr( isSnapshotArray<Type> ){
+            using Element = typename Type::value_type;
+            if( size % sizeof(Element) != 0 ){
+                throw std::runtime_error("Invalid size of a " + binaryTypeName<Type>() + " in the snapshot");
+            }
+            return std::span<const Element>(reinterpret_cast<const Element *>(data), size / sizeof(Element));
+        } else {
+            BinaryDecoder decoder(std::span<const std::byte>(data, size));
+            return decoder.template read<Type>();
+        }
+    }
+
+    //! Copy the value of the alternative `index` from the `size` bytes at `data` into a GeneralType
+    static GenType materialize(std::size_t index, const std::byte * data, std::size_t size){
+        static constexpr auto table = makeMaterializeTable(std::make_index_sequence<numberOfAlternatives>{});
+        if( index >= numberOfAlternatives ){
+            throw std::runtime_error("Invalid alternative " + std::to_string(index) + " in the snapshot");
+        }
+        return table[index](data, size);
+    }
+
+    protected:
+    //! Table entry of `encode` for the alternative `Index`
+    template<std::size_t Index>
+    static void encodeEntry(BinaryEncoder & encoder, const GenType & genT){
+        using Alternative = std::variant_alternative_t<Index,Variant>;
+        const Alternative & value = *std::get_if<Index>(&genT.obj_);
+        if constexpr( isSnapshotScalar<Alternative> ){
+            encoder.writeBytes(&value, sizeof(Alternative));
+        } else if constexpr( std::is_same_v<Alternative,std::string> ){
+            encoder.writeBytes(value.data(), value.size());
+        } else if constexpr( isSnapshotArray<Alternative> ){
+            encoder.writeBytes(value.data(), value.size() * sizeof(typename Alternative::value_type));
+        } else if constexpr( isBinaryEncodable<Alternative> ){
+            encoder.write(value);
+        } else {
+            ErrorPolicy::unsupported([]{
+                return "Can not store held type (" + GenType::alternativeName(Index) + ") in a snapshot";
+            });
+        }
+    }
+
+    template<std::size_t ... Indices>
+    static constexpr auto makeEncodeTable(std::index_sequence<Indices...>){
+        using Entry = void (*)(BinaryEncoder &, const GenType &);
+        return std::array<Entry, sizeof...(Indices)>{ &encodeEntry<Indices>... };
+    }
+
+    //! Table entry of `materialize` for the alternative `Index`
+    template<std::size_t Index>
+    static GenType materializeEntry(const std::byte * data, std::size_t size){
+        using Alternative = std::variant_alternative_t<Index,Variant>;
+        if constexpr( isBinaryEncodable<Alternative> ){
+            const auto value = read<Alternative>(data, size);
+            GenType genT;
+            if constexpr( std::is_same_v<Alternative,std::string> || isSnapshotArray<Alternative> ){
+                genT.obj_.template emplace<Index>(value.begin(), value.end());
+            } else {
+                genT.obj_.template emplace<Index>(std::move(value));
+            }
+            return genT;
+        } else {
+            throw std::runtime_error("Invalid alternative (" + GenType::alternativeName(Index) + ") in the snapshot");
+        }
+    }
+
+    template<std::size_t ... Indices>
+    static constexpr auto makeMaterializeTable(std::index_sequence<Indices...>){
+        using Entry = GenType (*)(const std::byte *, std::size_t);
+        return std::array<Entry, sizeof...(Indices)>{ &materializeEntry<Indices>... };
+    }
+};
+
+/*!
+ * A value in a snapshot of GeneralTypes of type `GenType`. It refers to the snapshot and reads the held
+ * alternative on access, strings and vectors of numbers are not copied.
+ */
+template<typename GenType>
+class SnapshotValue {
+    public:
+    //! Index of the held alternative, the same as in `GenType`
+    std::size_t index() const {
+        return alternative_;
+    }
+
+    //! Check if the value holds a `Type`
+    template<typename Type>
+    bool holds() const {
+        return alternative_ == SnapshotFormat<GenType>::template indexOf<Type>;
+    }
+
+    /*!
+     * Read the held `Type`, throws a `std::bad_variant_access` if another type is held. Strings are read as
+     * `std::string_view` and vectors of numbers as `std::span`, which are valid as long as the snapshot.
+     */
+    template<typename Type>
+    typename SnapshotAccess<Type>::type get() const {
+        if( !holds<Type>() ){
+            throw std::bad_variant_access();
+        }
+        return SnapshotFormat<GenType>::template read<Type>(data_, size_);
+    }
+
+    //! Copy the value into a `GenType`
+    GenType value() const {
+        return SnapshotFormat<GenType>::materialize(alternative_, data_, size_);
+    }
+
+    //! Copy the value into a `GenType`
+    operator GenType() const {
+        return value();
+    }
+
+    protected:
+    template<typename> friend class GeneralSnapshot;
+
+    SnapshotValue(const std::byte * data, std::size_t size, std::size_t alternative) :
+        data_(data), size_(size), alternative_(alternative)
+    {}
+
+    const std::byte * data_;
+    std::size_t size_;
+    std::size_t alternative_;
+};
+
+/*!
+ * A read only dictionary of GeneralTypes of type `GenType`, which is read in place from a snapshot written by
+ * `toSnapshot` or `writeSnapshot`. The snapshot is a memory mapped file or a buffer owned by the caller.
+ * Opening a snapshot only checks its header, keys are looked up in the index stored in the snapshot and
+ * values are read on access. Offsets and sizes are checked before they are used, such that invalid snapshots
+ * throw a `std::runtime_error` instead of reading outside of the snapshot.
+ */
+template<typename GenType>
+class GeneralSnapshot {
+    protected:
+    static constexpr std::size_t notFound = std::numeric_limits<std::size_t>::max();
+
+    public:
+    using Value = SnapshotValue<GenType>;
+
+    //! Iterates over the keys and values in the order they were written
+    class Iterator {
+        public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::pair<std::string_view, Value>;
+        using difference_type = std::ptrdiff_t;
+
+        Iterator() = default;
+
+        value_type operator*() const {
+            return {snapshot_->keyOf(index_), snapshot_->valueOf(index_)};
+        }
+
+        Iterator & operator++(){
+            ++index_;
+            return *this;
+        }
+
+        Iterator operator++(int){
+            Iterator old = *this;
+            ++index_;
+            return old;
+        }
+
+        bool operator==(const Iterator & other) const = default;
+
+        protected:
+        friend class GeneralSnapshot;
+
+        Iterator(const GeneralSnapshot * snapshot, std::size_t index) :
+            snapshot_(snapshot), index_(index)
+        {}
+
+        const GeneralSnapshot * snapshot_ = nullptr;
+        std::size_t index_ = 0;
+    };
+
+    //! Map the snapshot in the file `path`, throws a `std::system_error` if the file can not be mapped
+    explicit GeneralSnapshot(const std::string & path) :
+        file_(std::make_unique<MappedFile>(path))
+    {
+        open(file_->bytes());
+    }
+
+    //! Read the snapshot in `data`, which is not copied and has to be aligned to 8 bytes
+    explicit GeneralSnapshot(std::span<const std::byte> data){
+        open(data);
+    }
+
+    GeneralSnapshot(GeneralSnapshot &&) = default;
+    GeneralSnapshot & operator=(GeneralSnapshot &&) = default;
+
+    //! Number of entries
+    std::size_t size() const {
+        return numberOfEntries_;
+    }
+
+    //! Check if the snapshot has no entries
+    bool empty() const {
+        return numberOfEntries_ == 0;
+    }
+
+    Iterator begin() const {
+        return Iterator(this, 0);
+    }
+
+    Iterator end() const {
+        return Iterator(this, numberOfEntries_);
+    }
+
+    //! The value of `key`, if it is contained
+    std::optional<Value> find(std::string_view key) const {
+        return valueOrNothing(findEntry(key, hashKey(key)));
+    }
+
+    //! The value of the precomputed key `key`, if it is contained
+    std::optional<Value> find(DictKey key) const {
+        return valueOrNothing(findEntry(key.name(), key.hash()));
+    }
+
+    //! Check if `key` is contained
+    bool contains(std::string_view key) const {
+        return findEntry(key, hashKey(key)) != notFound;
+    }
+
+    //! Check if the precomputed key `key` is contained
+    bool contains(DictKey key) const {
+        return findEntry(key.name(), key.hash()) != notFound;
+    }
+
+    //! The value of `key`, throws a `std::out_of_range` if the key is not contained
+    Value at(std::string_view key) const {
+        return valueOf(checkedEntry(findEntry(key, hashKey(key)), key));
+    }
+
+    //! The value of the precomputed key `key`, throws a `std::out_of_range` if the key is not contained
+    Value at(DictKey key) const {
+        return valueOf(checkedEntry(findEntry(key.name(), key.hash()), key.name()));
+    }
+
+    protected:
+    //! Check the header of `data` and the bounds of the index and the entries
+    void open(std::span<const std::byte> data){
+        static_assert(std::endian::native == std::endian::little, "Snapshots are only read on little endian platforms");
+        if( reinterpret_cast<std::uintptr_t>(data.data()) % snapshotAlignment != 0 ){
+            throw std::runtime_error("A snapshot has to be aligned to 8 bytes");
+        }
+        SnapshotHeader header;
+        if( data.size() < sizeof(header) ){
+            throw std::runtime_error("Not a GeneralType snapshot");
+        }
+        std::memcpy(&header, data.data(), sizeof(header));
+        if( std::memcmp(header.magic, binaryMagic, sizeof(binaryMagic)) != 0 || header.kind != snapshotDocument ){
+            throw std::runtime_error("Not a GeneralType snapshot");
+        }
+        if( header.version != binaryFormatVersion ){
+            throw std::runtime_error(
+                "Unsupported version " + std::to_string(header.version) + " of the GeneralType snapshot, expected "
+                + std::to_string(binaryFormatVersion)
+            );
+        }
+        if( header.typeListHash != BinaryFormat<GenType>::typeListHash() ){
+            throw std::runtime_error("The snapshot was written by a GeneralType with different types");
+        }
+        // the index has fewer entries than slots and the tables fit into the snapshot
+        const std::uint64_t maximalSlots = (data.size() - sizeof(header)) / sizeof(SnapshotSlot);
+        if( !std::has_single_bit(header.numberOfSlots) || header.numberOfSlots > maximalSlots
+            || header.numberOfEntries >= header.numberOfSlots
+            || header.numberOfEntries > (data.size() - sizeof(header) - header.numberOfSlots * sizeof(SnapshotSlot)) / sizeof(SnapshotEntry) )
+        {
+            throw std::runtime_error("Invalid index in the GeneralType snapshot");
+        }
+        data_ = data;
+        numberOfEntries_ = std::size_t(header.numberOfEntries);
+        numberOfSlots_ = std::size_t(header.numberOfSlots);
+        slots_ = reinterpret_cast<const SnapshotSlot *>(data.data() + sizeof(header));
+        entries_ = reinterpret_cast<const SnapshotEntry *>(slots_ + numberOfSlots_);
+    }
+
+    //! Index of the entry of `key` with the hash `hash`, `notFound` if the key is not contained.
+    //! A written index always has an empty slot, the probe still stops after visiting every slot once,
+    //! such that a corrupted index without an empty slot can not loop forever.
+    std::size_t findEntry(std::string_view key, std::uint64_t hash) const {
+        const std::size_t mask = numberOfSlots_ - 1;
+        const std::uint32_t fingerprint = std::uint32_t(hash >> 32);
+        std::size_t position = hash & mask;
+        for(std::size_t step = 0; step < numberOfSlots_; ++step, position = (position + 1) & mask){
+            const SnapshotSlot & slot = slots_[position];
+            if( slot.entry == snapshotEmptySlot ){
+                return notFound;
+            }
+            if( slot.fingerprint == fingerprint && keyOf(slot.entry) == key ){
+                return slot.entry;
+            }
+        }
+        return notFound;
+    }
+
+    //! Check the `index` of the entry of `key`, throws a `std::out_of_range` if the key is not contained
+    static std::size_t checkedEntry(std::size_t index, std::string_view key){
+        if( index == notFound ){
+            throw std::out_of_range("The snapshot does not contain the key \"" + std::string(key) + "\"");
+        }
+        return index;
+    }
+
+    //! The entry `index`, throws a `std::runtime_error` if it is not in the snapshot
+    const SnapshotEntry & entryAt(std::size_t index) const {
+        if( index >= numberOfEntries_ ){
+            throw std::runtime_error("Invalid entry " + std::to_string(index) + " in the GeneralType snapshot");
+        }
+        return entries_[index];
+    }
+
+    //! Check that `size` bytes at `offset` are in the snapshot
+    void checkRange(std::uint64_t offset, std::uint64_t size) const {
+        if( offset > data_.size() || size > data_.size() - offset ){
+            throw std::runtime_error("Invalid offset " + std::to_string(offset) + " in the GeneralType snapshot");
+        }
+    }
+
+    //! The key of the entry `index`
+    std::string_view keyOf(std::size_t index) const {
+        const SnapshotEntry & entry = entryAt(index);
+        checkRange(entry.keyOffset, entry.keySize);
+        return std::string_view(reinterpret_cast<const char *>(data_.data() + entry.keyOffset), entry.keySize);
+    }
+
+    //! The value of the entry `index`
+    Value valueOf(std::size_t index) const {
+        const SnapshotEntry & entry = entryAt(index);
+        checkRange(entry.valueOffset, entry.valueSize);
+        if( entry.valueOffset % snapshotAlignment != 0 ){
+            throw std::runtime_error("Misaligned value in the GeneralType snapshot");
+        }
+        return Value(data_.data() + entry.valueOffset, std::size_t(entry.valueSize), entry.alternative);
+    }
+
+    std::optional<Value> valueOrNothing(std::size_t index) const {
+        if( index == notFound ){ return std::nullopt; }
+        return valueOf(index);
+    }
+
+    //! The mapped file, empty if the snapshot is a buffer of the caller
+    std::unique_ptr<MappedFile> file_;
+
+    std::span<const std::byte> data_;
+    std::size_t numberOfEntries_ = 0;
+    std::size_t numberOfSlots_ = 0;
+    const SnapshotSlot * slots_ = nullptr;
+    const SnapshotEntry * entries_ = nullptr;
+};
+
+namespace {
+
+//! Write the snapshot of `dict`, a `GeneralDict` or a `std::map` of strings and GeneralTypes, to `out`
+template<typename GenType, typename Dict>
+void encodeSnapshotEntries(std::vector<std::byte> & out, const Dict & dict){
+    static_assert(std::endian::native == std::endian::little, "Snapshots are only written on little endian platforms");
+    if( dict.size() >= snapshotEmptySlot ){
+        throw std::length_error("A snapshot holds less than 2^32 - 1 entries");
+    }
+    SnapshotHeader header{};
+    std::memcpy(header.magic, binaryMagic, sizeof(binaryMagic));
+    header.version = binaryFormatVersion;
+    header.kind = snapshotDocument;
+    header.typeListHash = BinaryFormat<GenType>::typeListHash();
+    header.numberOfEntries = dict.size();
+    header.numberOfSlots = snapshotSlotsFor(dict.size());
+
+    std::vector<SnapshotSlot> slots(header.numberOfSlots, SnapshotSlot{0, snapshotEmptySlot});
+    std::vector<SnapshotEntry> entries(dict.size());
+    const std::size_t mask = slots.size() - 1;
+
+    // the keys and values follow the tables, which are copied to the front once the offsets are known
+    const std::size_t tableSize = sizeof(header) + slots.size() * sizeof(SnapshotSlot) + entries.size() * sizeof(SnapshotEntry);
+    out.assign(tableSize, std::byte{0});
+    {
+        BinaryEncoder encoder(out);
+        const std::byte padding[snapshotAlignment] = {};
+        std::size_t index = 0;
+        for(const auto & [key,value]: dict){
+            SnapshotEntry & entry = entries[index];
+            entry.keyOffset = encoder.size();
+            entry.keySize = std::uint32_t(key.size());
+            encoder.writeBytes(key.data(), key.size());
+            encoder.writeBytes(padding, (snapshotAlignment - encoder.size() % snapshotAlignment) % snapshotAlignment);
+            entry.valueOffset = encoder.size();
+            entry.alternative = std::uint8_t(SnapshotFormat<GenType>::encode(encoder, value));
+            entry.valueSize = encoder.size() - entry.valueOffset;
+
+            const std::uint64_t hash = hashKey(key);
+            std::size_t position = hash & mask;
+            while( slots[position].entry != snapshotEmptySlot ){ position = (position + 1) & mask; }
+            slots[position] = SnapshotSlot{std::uint32_t(hash >> 32), std::uint32_t(index)};
+            ++index;
+        }
+    }
+    std::memcpy(out.data(), &header, sizeof(header));
+    // the data of an empty vector may be null, which memcpy does not accept even for zero bytes
+    if( !slots.empty() ){
+        std::memcpy(out.data() + sizeof(header), slots.data(), slots.size() * sizeof(SnapshotSlot));
+    }
+    if( !entries.empty() ){
+        std::memcpy(out.data() + sizeof(header) + slots.size() * sizeof(SnapshotSlot), entries.data(), entries.size() * sizeof(SnapshotEntry));
+    }
+}
+
+//! Write the snapshot of a `GeneralDict` to `out`
+template<typename ErrorPolicy, bool StableOrder, typename ... Types_>
+void encodeSnapshot(std::vector<std::byte> & out, const BasicGeneralDict<ErrorPolicy,StableOrder,Types_...> & dict){
+    encodeSnapshotEntries<BasicGeneralType<ErrorPolicy,Types_...>>(out, dict);
+}
+
+//! Write the snapshot of a `std::map` of strings and GeneralTypes to `out`
+template<typename ErrorPolicy, typename ... Types_, typename Compare, typename Allocator>
+void encodeSnapshot(
+    std::vector<std::byte> & out,
+    const std::map<std::string,BasicGeneralType<ErrorPolicy,Types_...>,Compare,Allocator> & dict)
+{
+    encodeSnapshotEntries<BasicGeneralType<ErrorPolicy,Types_...>>(out, dict);
+}
+
+} // namespace
+
+//! The snapshot of `dict`, a `GeneralDict` or a `std::map<std::string,GenType>`, which is read by `GeneralSnapshot`
+template<typename Dict>
+std::vector<std::byte> toSnapshot(const Dict & dict){
+    std::vector<std::byte> out;
+    encodeSnapshot(out, dict);
+    return out;
+}
+
+//! Write the snapshot of `dict` to the stream `os`, which should be opened in binary mode
+template<typename Dict>
+void writeSnapshot(std::ostream & os, const Dict & dict){
+    const std::vector<std::byte> data = toSnapshot(dict);
+    os.write(reinterpret_cast<const char *>(data.data()), std::streamsize(data.size()));
+}
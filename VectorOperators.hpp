@@ -0,0 +1,365 @@
+#pragma once
+
+#include<vector>
+#include<complex>
+#include<memory>
+#include<string>
+#include<stdexcept>
+#include<type_traits>
+#include<utility>
+#include<cstring>
+#include<cstddef>
+
+// Element wise operators for the std::vector alternatives of a GeneralType, e.g. `std::vector<double> + double`
+// or `std::vector<float> < std::vector<float>`. std::vector itself does not define them, so the operators of
+// the GeneralType fall back to the kernels below. Loops over arithmetic elements are written with the vector
+// extensions of GCC and compiled for AVX-512, AVX2 and the baseline instruction set, the widest one
+// supported by the CPU is chosen at runtime. Loops over std::complex elements run on their real and 
+// imaginary parts where possible and are plain loops otherwise.
+
+namespace {
+
+//! Checks if `Type` is a `std::complex`
+template<typename Type>
+constexpr bool isComplex = false;
+
+template<typename Type>
+constexpr bool isComplex<std::complex<Type>> = true;
+
+//! A concept that checks if `Type` can be an element of the element wise operators.
+//! `bool` is excluded, as `std::vector<bool>` does not store its elements contiguously.
+template<typename Type>
+concept isNumericElement = (std::is_arithmetic_v<Type> && !std::is_same_v<Type,bool>) || isComplex<Type>;
+
+//! Element type of a `std::vector` of numeric elements, `void` for all other types
+template<typename Type>
+struct NumericVectorElement { using type = void; };
+
+template<typename Element, typename Allocator>
+    requires isNumericElement<Element>
+struct NumericVectorElement<std::vector<Element,Allocator>> { using type = Element; };
+
+//! A concept that checks if `Type` is a `std::vector` of numeric elements
+template<typename Type>
+concept isNumericVector = !std::is_void_v<typename NumericVectorElement<std::remove_cvref_t<Type>>::type>;
+
+//! Element type of a vector operand or the type of a scalar operand
+template<typename Type>
+using OperandElement = std::conditional_t<isNumericVector<Type>,
+    typename NumericVectorElement<std::remove_cvref_t<Type>>::type, std::remove_cvref_t<Type>
+>;
+
+// The following structs implement the operator applied to every element. They take vectors of the GCC
+// vector extensions as well as single elements and write their result to a reference, so no vector is
+// passed by value to a function compiled for a different instruction set.
+
+//! Element wise addition
+struct ElementwiseAddition {
+    static constexpr const char * name = "operator+";
+    template<typename T, typename U> using Result = decltype(std::declval<T>() + std::declval<U>());
+    template<typename T, typename U> [[gnu::always_inline]] static void apply(Result<const T&,const U&> & r, const T & t, const U & u){ r = t + u; }
+};
+
+//! Element wise subtraction
+struct ElementwiseSubtraction {
+    static constexpr const char * name = "operator-";
+    template<typename T, typename U> using Result = decltype(std::declval<T>() - std::declval<U>());
+    template<typename T, typename U> [[gnu::always_inline]] static void apply(Result<const T&,const U&> & r, const T & t, const U & u){ r = t - u; }
+};
+
+//! Element wise multiplication
+struct ElementwiseMultiplication {
+    static constexpr const char * name = "operator*";
+    template<typename T, typename U> using Result = decltype(std::declval<T>() * std::declval<U>());
+    template<typename T, typename U> [[gnu::always_inline]] static void apply(Result<const T&,const U&> & r, const T & t, const U & u){ r = t * u; }
+};
+
+//! Element wise division
+struct ElementwiseDivision {
+    static constexpr const char * name = "operator/";
+    template<typename T, typename U> using Result = decltype(std::declval<T>() / std::declval<U>());
+    template<typename T, typename U> [[gnu::always_inline]] static void apply(Result<const T&,const U&> & r, const T & t, const U & u){ r = t / u; }
+};
+
+//! Element wise smaller comparison
+struct ElementwiseSmaller {
+    static constexpr const char * name = "operator<";
+    template<typename T, typename U> using Result = decltype(std::declval<T>() < std::declval<U>());
+    template<typename T, typename U> [[gnu::always_inline]] static void apply(Result<const T&,const U&> & r, const T & t, const U & u){ r = t < u; }
+};
+
+//! Element wise larger comparison
+struct ElementwiseLarger {
+    static constexpr const char * name = "operator>";
+    template<typename T, typename U> using Result = decltype(std::declval<T>() > std::declval<U>());
+    template<typename T, typename U> [[gnu::always_inline]] static void apply(Result<const T&,const U&> & r, const T & t, const U & u){ r = t > u; }
+};
+
+//! Element wise smaller equal comparison
+struct ElementwiseSmallerEqual {
+    static constexpr const char * name = "operator<=";
+    template<typename T, typename U> using Result = decltype(std::declval<T>() <= std::declval<U>());
+    template<typename T, typename U> [[gnu::always_inline]] static void apply(Result<const T&,const U&> & r, const T & t, const U & u){ r = t <= u; }
+};
+
+//! Element wise larger equal comparison
+struct ElementwiseLargerEqual {
+    static constexpr const char * name = "operator>=";
+    template<typename T, typename U> using Result = decltype(std::declval<T>() >= std::declval<U>());
+    template<typename T, typename U> [[gnu::always_inline]] static void apply(Result<const T&,const U&> & r, const T & t, const U & u){ r = t >= u; }
+};
+
+//! Result of `Operation` on the elements of the operands `T` and `U`
+template<typename Operation, typename T, typename U>
+using ElementwiseResult = typename Operation::template Result<const OperandElement<T> &, const OperandElement<U> &>;
+
+//! A concept that checks if `Operation` can be applied element wise to `T` and `U`,
+//! i.e. at least one of them is a vector of numeric elements and the other one a numeric element or vector
+template<typename Operation, typename T, typename U>
+concept areElementwise = (isNumericVector<T> || isNumericVector<U>)
+    && isNumericElement<OperandElement<T>> && isNumericElement<OperandElement<U>>
+    && requires { typename ElementwiseResult<Operation,T,U>; };
+
+//! A concept that checks if `Operation` can be applied element wise to `T` and `U` and the result
+//! can be assigned to the elements of the vector `T`
+template<typename Operation, typename T, typename U>
+concept areElementwiseAssignable = isNumericVector<T> && !std::is_const_v<std::remove_reference_t<T>>
+    && areElementwise<Operation,T,U>
+    && std::is_convertible_v<ElementwiseResult<Operation,T,U>, OperandElement<T>>;
+
+//! A vector of `Lanes` elements of type `Type` from the vector extensions of GCC
+template<typename Type, std::size_t Lanes>
+struct SimdVector { typedef Type type __attribute__((vector_size(Lanes * sizeof(Type)))); };
+
+template<typename Type, std::size_t Lanes>
+using SimdType = typename SimdVector<Type,Lanes>::type;
+
+//! A vector operand of an element wise operator
+template<typename Type>
+struct ArrayOperand {
+    using Element = Type;
+    const Element * data;
+
+    Element operator[](std::size_t i) const { return data[i]; }
+
+    //! Load the `Lanes` elements starting at `i` converted to `Compute`
+    template<typename Compute, std::size_t Lanes>
+    [[gnu::always_inline]] void load(SimdType<Compute,Lanes> & result, std::size_t i) const {
+        SimdType<Element,Lanes> elements;
+        std::memcpy(&elements, data + i, sizeof(elements));
+        result = __builtin_convertvector(elements, SimdType<Compute,Lanes>);
+    }
+};
+
+//! A scalar operand of an element wise operator, broadcast to all elements
+template<typename Type>
+struct ScalarOperand {
+    using Element = Type;
+    Element value;
+
+    Element operator[](std::size_t) const { return value; }
+
+    //! Broadcast the value converted to `Compute` to all `Lanes`
+    template<typename Compute, std::size_t Lanes>
+    [[gnu::always_inline]] void load(SimdType<Compute,Lanes> & result, std::size_t) const {
+        for(std::size_t lane = 0; lane < Lanes; ++lane){ result[lane] = Compute(value); }
+    }
+};
+
+//! Checks if the vector extensions of GCC support `Type` as element
+template<typename Type>
+constexpr bool isSimdElement = (std::is_integral_v<Type> || std::is_same_v<Type,float> || std::is_same_v<Type,double>)
+    && !std::is_same_v<Type,bool> && sizeof(Type) <= 8;
+
+//! Applies `Operation` to `size` elements of `lhs` and `rhs` and stores the results in `out`,
+//! `Bytes` bytes of the common type of the elements at once
+template<std::size_t Bytes, typename Operation, typename Out, typename Lhs, typename Rhs>
+[[gnu::always_inline]] inline void simdLoop(Out * out, Lhs lhs, Rhs rhs, std::size_t size){
+    using Compute = decltype(typename Lhs::Element{} + typename Rhs::Element{});
+    constexpr std::size_t lanes = Bytes / sizeof(Compute);
+    using Vector = SimdType<Compute,lanes>;
+
+    std::size_t i = 0;
+    for(; i + lanes <= size; i += lanes){
+        Vector lhsVector, rhsVector;
+        lhs.template load<Compute,lanes>(lhsVector, i);
+        rhs.template load<Compute,lanes>(rhsVector, i);
+        typename Operation::template Result<const Vector &,const Vector &> result;
+        Operation::apply(result, lhsVector, rhsVector);
+        if constexpr( std::is_same_v<Out,bool> ){
+            // comparisons yield a mask with all bits set for true
+            const auto bytes = __builtin_convertvector(result, SimdType<unsigned char,lanes>) & 1;
+            std::memcpy(out + i, &bytes, sizeof(bytes));
+        } else {
+            const auto converted = __builtin_convertvector(result, SimdType<Out,lanes>);
+            std::memcpy(out + i, &converted, sizeof(converted));
+        }
+    }
+    for(; i < size; ++i){
+        typename Operation::template Result<const Compute &,const Compute &> result;
+        Operation::apply(result, Compute(lhs[i]), Compute(rhs[i]));
+        out[i] = Out(result);
+    }
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+
+//! `simdLoop` compiled for AVX-512
+template<typename Operation, typename Out, typename Lhs, typename Rhs>
+[[gnu::target("avx512f")]] void simdLoopAvx512(Out * out, Lhs lhs, Rhs rhs, std::size_t size){
+    simdLoop<64,Operation>(out, lhs, rhs, size);
+}
+
+//! `simdLoop` compiled for AVX2
+template<typename Operation, typename Out, typename Lhs, typename Rhs>
+[[gnu::target("avx2")]] void simdLoopAvx2(Out * out, Lhs lhs, Rhs rhs, std::size_t size){
+    simdLoop<32,Operation>(out, lhs, rhs, size);
+}
+
+#endif
+
+//! The instruction sets the element wise operators are compiled for
+enum class SimdLevel { Baseline, Avx2, Avx512 };
+
+//! The widest instruction set supported by the CPU, detected once
+inline SimdLevel simdLevel(){
+#if defined(__x86_64__) || defined(__i386__)
+    static const SimdLevel level = __builtin_cpu_supports("avx512f") ? SimdLevel::Avx512
+        : __builtin_cpu_supports("avx2") ? SimdLevel::Avx2 : SimdLevel::Baseline;
+    return level;
+#else
+    return SimdLevel::Baseline;
+#endif
+}
+
+// A std::complex is stored as its real and imaginary part next to each other. Operators that act on both
+// parts alike, the sum of two complex vectors or the product with a real scalar, run on the parts instead.
+
+//! Checks if `Operation` on the complex operands `Lhs` and `Rhs` can run on the real and imaginary parts
+template<typename Operation, typename Out, typename Lhs, typename Rhs>
+constexpr bool actsOnParts(){
+    if constexpr( isComplex<Out> ){
+        using Complex = ArrayOperand<Out>;
+        using Real = ScalarOperand<typename Out::value_type>;
+        constexpr bool isSum = std::is_same_v<Operation,ElementwiseAddition> || std::is_same_v<Operation,ElementwiseSubtraction>;
+        constexpr bool isProduct = std::is_same_v<Operation,ElementwiseMultiplication> || std::is_same_v<Operation,ElementwiseDivision>;
+        return (isSum && std::is_same_v<Lhs,Complex> && std::is_same_v<Rhs,Complex>)
+            || (isProduct && std::is_same_v<Lhs,Complex> && std::is_same_v<Rhs,Real>)
+            || (std::is_same_v<Operation,ElementwiseMultiplication> && std::is_same_v<Lhs,Real> && std::is_same_v<Rhs,Complex>);
+    } else {
+        return false;
+    }
+}
+
+//! View a vector operand of complex elements as its real and imaginary parts
+template<typename Type>
+ArrayOperand<Type> realParts(ArrayOperand<std::complex<Type>> operand){
+    return {reinterpret_cast<const Type *>(operand.data)};
+}
+
+template<typename Type>
+ScalarOperand<Type> realParts(ScalarOperand<Type> operand){
+    return operand;
+}
+
+//! Applies `Operation` to `size` elements of `lhs` and `rhs` and stores the results in `out`
+template<typename Operation, typename Out, typename Lhs, typename Rhs>
+void elementwiseLoop(Out * out, Lhs lhs, Rhs rhs, std::size_t size){
+    using Compute = decltype(typename Lhs::Element{} + typename Rhs::Element{});
+    if constexpr( isSimdElement<typename Lhs::Element> && isSimdElement<typename Rhs::Element>
+        && isSimdElement<Compute> && (isSimdElement<Out> || std::is_same_v<Out,bool>) )
+    {
+#if defined(__x86_64__) || defined(__i386__)
+        switch( simdLevel() ){
+            case SimdLevel::Avx512: return simdLoopAvx512<Operation>(out, lhs, rhs, size);
+            case SimdLevel::Avx2:   return simdLoopAvx2<Operation>(out, lhs, rhs, size);
+            case SimdLevel::Baseline: break;
+        }
+#endif
+        simdLoop<16,Operation>(out, lhs, rhs, size);
+    } else if constexpr( actsOnParts<Operation,Out,Lhs,Rhs>() ){
+        using Part = typename Out::value_type;
+        elementwiseLoop<Operation>(reinterpret_cast<Part *>(out), realParts(lhs), realParts(rhs), 2*size);
+    } else {
+        for(std::size_t i = 0; i < size; ++i){
+            const typename Lhs::Element lhsElement = lhs[i];
+            const typename Rhs::Element rhsElement = rhs[i];
+            typename Operation::template Result<const typename Lhs::Element &,const typename Rhs::Element &> result;
+            Operation::apply(result, lhsElement, rhsElement);
+            out[i] = Out(result);
+        }
+    }
+}
+
+//! Wrap `operand` in an `ArrayOperand` if it is a vector, in a `ScalarOperand` otherwise
+template<typename Type>
+auto makeOperand(const Type & operand){
+    if constexpr( isNumericVector<Type> ){
+        return ArrayOperand<OperandElement<Type>>{operand.data()};
+    } else {
+        return ScalarOperand<Type>{operand};
+    }
+}
+
+//! Number of elements of the element wise operator on `lhs` and `rhs`, throws if two vectors differ in size
+template<typename Operation, typename T, typename U>
+std::size_t elementwiseSize(const T & lhs, const U & rhs){
+    if constexpr( isNumericVector<T> && isNumericVector<U> ){
+        if( lhs.size() != rhs.size() ){
+            throw std::invalid_argument("Element wise " + std::string(Operation::name)
+                + " on vectors of different size (" + std::to_string(lhs.size())
+                + " and " + std::to_string(rhs.size()) + ")");
+        }
+        return lhs.size();
+    } else if constexpr( isNumericVector<T> ){
+        return lhs.size();
+    } else {
+        return rhs.size();
+    }
+}
+
+//! The allocator of the result of an element wise operator with elements of type `Element`, obtained from the
+//! allocator of the first vector operand like the allocator of a copy of it
+template<typename Element, typename T, typename U>
+auto resultAllocator(const T & lhs, const U & rhs){
+    const auto & vector = [&]() -> const auto & {
+        if constexpr( isNumericVector<T> ){ return lhs; } else { return rhs; }
+    }();
+    using Allocator = typename std::remove_cvref_t<decltype(vector)>::allocator_type;
+    using ResultAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Element>;
+    return ResultAllocator(std::allocator_traits<Allocator>::select_on_container_copy_construction(vector.get_allocator()));
+}
+
+//! Applies `Operation` element wise to `lhs` and `rhs`, a scalar is applied to every element of the other operand.
+//! The resulting vector uses the allocator of the vector operand, e.g. a `std::pmr` allocator.
+template<typename Operation, typename T, typename U>
+    requires areElementwise<Operation,T,U>
+auto elementwise(const T & lhs, const U & rhs){
+    using Result = ElementwiseResult<Operation,T,U>;
+    const std::size_t size = elementwiseSize<Operation>(lhs,rhs);
+    const auto allocator = resultAllocator<Result>(lhs, rhs);
+
+    if constexpr( std::is_same_v<Result,bool> ){
+        // std::vector<bool> packs its elements, so the results are collected in a buffer from the same allocator first
+        using Allocator = std::remove_const_t<decltype(allocator)>;
+        Allocator bufferAllocator = allocator;
+        const auto release = [&](bool * buffer){ std::allocator_traits<Allocator>::deallocate(bufferAllocator, buffer, size); };
+        std::unique_ptr<bool[], decltype(release)> buffer(std::allocator_traits<Allocator>::allocate(bufferAllocator, size), release);
+        elementwiseLoop<Operation>(buffer.get(), makeOperand(lhs), makeOperand(rhs), size);
+        return std::vector<bool,Allocator>(buffer.get(), buffer.get() + size, allocator);
+    } else {
+        std::vector<Result,std::remove_const_t<decltype(allocator)>> result(size, allocator);
+        elementwiseLoop<Operation>(result.data(), makeOperand(lhs), makeOperand(rhs), size);
+        return result;
+    }
+}
+
+//! Applies `Operation` element wise to `lhs` and `rhs` and assigns the results to the elements of `lhs`
+template<typename Operation, typename T, typename U>
+    requires areElementwiseAssignable<Operation,T&,U>
+void elementwiseAssign(T & lhs, const U & rhs){
+    const std::size_t size = elementwiseSize<Operation>(lhs,rhs);
+    elementwiseLoop<Operation>(lhs.data(), makeOperand(lhs), makeOperand(rhs), size);
+}
+
+} // namespace
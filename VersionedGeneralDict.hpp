@@ -0,0 +1,306 @@
+#pragma once
+
+#include "GeneralDict.hpp"
+
+#include<algorithm>
+#include<atomic>
+#include<cstddef>
+#include<cstdint>
+#include<limits>
+#include<memory>
+#include<mutex>
+#include<optional>
+#include<string_view>
+#include<utility>
+#include<vector>
+
+// A versioned dictionary for read-mostly data like configurations, in the style of read-copy-update (RCU).
+// Every version is an immutable `GeneralDict`. A writer copies the current version, modifies the copy and
+// publishes it by swapping a single pointer. Readers load that pointer and read the version without any lock;
+// a version stays alive until no reader can reference it anymore. This is tracked by epochs: a reader marks
+// its thread with the current epoch while it reads and a writer starts a new epoch whenever it replaces a
+// version. The replaced version is freed once every thread that still reads has entered a later epoch.
+// Readers only write to a cache line of their own thread, so they never contend with each other and are
+// never blocked by a writer.
+
+/*!
+ * The epochs of all threads reading a `VersionedGeneralDict`. There is one domain per program, every
+ * thread that reads gets a record in it the first time it reads and gives it back to the domain on exit.
+ */
+class EpochDomain {
+    public:
+    //! Marks that no reader is active on a thread
+    static constexpr std::uint64_t quiescent = 0;
+
+    //! The domain shared by all versioned dictionaries
+    static EpochDomain & global(){
+        static EpochDomain domain;
+        return domain;
+    }
+
+    EpochDomain(const EpochDomain &) = delete;
+    EpochDomain & operator=(const EpochDomain &) = delete;
+
+    ~EpochDomain(){
+        for(Record * record = records_.load(); record != nullptr; ){
+            delete std::exchange(record, record->next);
+        }
+    }
+
+    //! Mark the current thread as reading in the current epoch. Reads can be nested.
+    void enter(){
+        Record & record = localRecord();
+        if( record.nesting++ == 0 ){
+            // sequentially consistent, such that the following load of a version is ordered after the store
+            record.epoch.store(epoch_.load());
+        }
+    }
+
+    //! Mark the end of the read started by the last `enter` of the current thread
+    void leave(){
+        Record & record = localRecord();
+        if( --record.nesting == 0 ){
+            record.epoch.store(quiescent, std::memory_order_release);
+        }
+    }
+
+    //! Start a new epoch, returns the previous one. Readers entering later can not reference anything
+    //! that was unpublished before.
+    std::uint64_t advance(){
+        return epoch_.fetch_add(1);
+    }
+
+    //! The oldest epoch a thread is reading in, the maximal value if no thread is reading
+    std::uint64_t oldestActiveEpoch() const {
+        std::uint64_t oldest = std::numeric_limits<std::uint64_t>::max();
+        for(const Record * record = records_.load(); record != nullptr; record = record->next){
+            const std::uint64_t epoch = record->epoch.load();
+            if( epoch != quiescent ){
+                oldest = std::min(oldest, epoch);
+            }
+        }
+        return oldest;
+    }
+
+    protected:
+    //! The epoch of a reading thread. Every record fills its own cache lines, such that the readers
+    //! of different threads do not write to the same cache line.
+    struct alignas(64) Record {
+        std::atomic<std::uint64_t> epoch = quiescent;
+        std::atomic<bool> used = true;
+        //! Number of nested reads of the owning thread, only accessed by that thread
+        std::size_t nesting = 0;
+        Record * next = nullptr;
+    };
+
+    //! Owns the record of a thread while the thread lives
+    struct Registration {
+        explicit Registration(EpochDomain & domain) :
+            record(domain.acquireRecord())
+        {}
+
+        ~Registration(){
+            record->used.store(false, std::memory_order_release);
+        }
+
+        Record * record;
+    };
+
+    EpochDomain() = default;
+
+    //! The record of the current thread
+    Record & localRecord(){
+        thread_local Registration registration(*this);
+        return *registration.record;
+    }
+
+    //! Reuse the record of a finished thread or append a new one. Records are never removed,
+    //! so their number is the maximal number of threads that read at the same time.
+    Record * acquireRecord(){
+        for(Record * record = records_.load(); record != nullptr; record = record->next){
+            bool used = false;
+            if( record->used.compare_exchange_strong(used, true) ){
+                return record;
+            }
+        }
+        Record * record = new Record;
+        record->next = records_.load();
+        while( !records_.compare_exchange_weak(record->next, record) ){}
+        return record;
+    }
+
+    //! The current epoch, starts at 1 since 0 marks a thread that is not reading
+    std::atomic<std::uint64_t> epoch_ = 1;
+
+    //! All records, a list that only grows
+    std::atomic<Record *> records_ = nullptr;
+};
+
+/*!
+ * A dictionary mapping strings to `GeneralType`s that is read by many threads without locks and replaced
+ * as a whole by writers. `read()` returns a `Snapshot`, a handle to the current version that stays valid
+ * and unchanged while the snapshot lives, even if a writer publishes a new version meanwhile.
+ * Writers are serialized by a mutex, readers never touch it.
+ *
+ * A snapshot has to be released by the thread that took it. Replaced versions are freed by writers in
+ * `publish`, `update` and `reclaim` once no snapshot references them.
+ */
+template<typename ErrorPolicy, typename ... Types_>
+class BasicVersionedGeneralDict{
+    public:
+    //! The type of the values
+    using mapped_type = BasicGeneralType<ErrorPolicy, Types_...>;
+
+    //! The dictionary of a version
+    using Dict = BasicGeneralDict<ErrorPolicy, false, Types_...>;
+
+    protected:
+    //! An immutable version of the dictionary
+    struct Version {
+        Dict dict;
+        std::uint64_t number;
+    };
+
+    //! A version that was replaced, it is freed once no reader is older than `epoch`
+    struct Retired {
+        std::uint64_t epoch;
+        const Version * version;
+    };
+
+    public:
+    //! A read-only handle to a version of the dictionary, the version is kept alive while the handle lives
+    class Snapshot {
+        public:
+        Snapshot(Snapshot && other) noexcept :
+            version_(std::exchange(other.version_, nullptr))
+        {}
+
+        Snapshot(const Snapshot &) = delete;
+        Snapshot & operator=(const Snapshot &) = delete;
+        Snapshot & operator=(Snapshot &&) = delete;
+
+        ~Snapshot(){
+            if( version_ != nullptr ){
+                EpochDomain::global().leave();
+            }
+        }
+
+        //! The dictionary of the version
+        const Dict & operator*() const { return version_->dict; }
+        const Dict * operator->() const { return &version_->dict; }
+
+        //! The number of the version, incremented by every publication
+        std::uint64_t version() const { return version_->number; }
+
+        private:
+        friend class BasicVersionedGeneralDict;
+
+        explicit Snapshot(const Version * version) :
+            version_(version)
+        {}
+
+        const Version * version_;
+    };
+
+    //! Construct a dictionary whose first version, number 0, is `dict`
+    explicit BasicVersionedGeneralDict(Dict dict = Dict()) :
+        current_(new Version{std::move(dict), 0})
+    {}
+
+    BasicVersionedGeneralDict(const BasicVersionedGeneralDict &) = delete;
+    BasicVersionedGeneralDict & operator=(const BasicVersionedGeneralDict &) = delete;
+
+    //! Free all versions, no snapshot may be alive anymore
+    ~BasicVersionedGeneralDict(){
+        delete current_.load();
+        for(const Retired & retired: retired_){
+            delete retired.version;
+        }
+    }
+
+    //! A snapshot of the current version, taken without a lock
+    Snapshot read() const {
+        EpochDomain::global().enter();
+        return Snapshot(current_.load());
+    }
+
+    //! A copy of the value of `key` in the current version, an empty optional if there is none
+    std::optional<mapped_type> get(std::string_view key) const {
+        const Snapshot snapshot = read();
+        const auto entry = snapshot->find(key);
+        if( entry == snapshot->end() ){
+            return std::nullopt;
+        }
+        return std::optional<mapped_type>(std::in_place, entry->second);
+    }
+
+    //! The number of the current version
+    std::uint64_t version() const {
+        return read().version();
+    }
+
+    //! Replace the current version by `dict`, returns the number of the new version
+    std::uint64_t publish(Dict dict){
+        std::lock_guard lock(writer_);
+        return publishLocked(std::move(dict));
+    }
+
+    //! Copy the current version, call `function` with the copy and publish it. Concurrent updates are
+    //! applied one after the other, none of them is lost. Returns the number of the new version.
+    template<typename Function>
+    std::uint64_t update(Function && function){
+        std::lock_guard lock(writer_);
+        // only writers free versions, so the current one stays alive while the lock is held
+        Dict dict = current_.load()->dict;
+        std::forward<Function>(function)(dict);
+        return publishLocked(std::move(dict));
+    }
+
+    //! Free the replaced versions that are not referenced by a snapshot anymore, returns the number of
+    //! versions that are still referenced
+    std::size_t reclaim(){
+        std::lock_guard lock(writer_);
+        reclaimLocked();
+        return retired_.size();
+    }
+
+    protected:
+    //! Publish `dict` as new version, the writer lock has to be held
+    std::uint64_t publishLocked(Dict dict){
+        const std::uint64_t number = current_.load()->number + 1;
+        const Version * replaced = current_.exchange(new Version{std::move(dict), number});
+        // readers that may have loaded `replaced` are marked with an epoch up to the one before the advance
+        retired_.push_back(Retired{EpochDomain::global().advance(), replaced});
+        reclaimLocked();
+        return number;
+    }
+
+    //! Free the replaced versions no reader can reference anymore, the writer lock has to be held
+    void reclaimLocked(){
+        const std::uint64_t oldest = EpochDomain::global().oldestActiveEpoch();
+        std::erase_if(retired_, [oldest](const Retired & retired){
+            if( retired.epoch < oldest ){
+                delete retired.version;
+                return true;
+            }
+            return false;
+        });
+    }
+
+    //! The current version
+    std::atomic<const Version *> current_;
+
+    //! Serializes the writers
+    std::mutex writer_;
+
+    //! Replaced versions that may still be read, only accessed by writers
+    std::vector<Retired> retired_;
+}; // BasicVersionedGeneralDict<ErrorPolicy,Types_...>
+
+//! A versioned dictionary mapping strings to `GeneralType<Types_...>`
+template<typename ... Types_>
+using VersionedGeneralDict = BasicVersionedGeneralDict<RuntimeErrorPolicy, Types_...>;
+
+//! A versioned dictionary mapping strings to `StrictGeneralType<Types_...>`
+template<typename ... Types_>
+using StrictVersionedGeneralDict = BasicVersionedGeneralDict<StrictErrorPolicy, Types_...>;
@@ -0,0 +1,70 @@
+#include "../AtomicGeneralType.hpp"
+#include "benchmark.hpp"
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Measures counting by several threads at once. An AtomicGeneralType is compared with a GeneralType
+// behind a std::mutex and with a plain std::atomic<int>. Every thread adds `increments` ones, a row
+// reports the time until all threads are done.
+
+typedef GeneralType<
+    bool, int, double
+> GenType;
+
+typedef AtomicGeneralType<
+    bool, int, double
+> AtomicGenType;
+
+//! Number of increments per thread and benchmark iteration
+constexpr std::size_t increments = 100000;
+
+//! Run `function()` on `numberOfThreads` threads and wait for all of them
+template<typename Function>
+void runThreads(std::size_t numberOfThreads, Function && function){
+    std::vector<std::thread> threads;
+    threads.reserve(numberOfThreads);
+    for(std::size_t t = 0; t < numberOfThreads; ++t){
+        threads.emplace_back(function);
+    }
+    for(std::thread & thread: threads){ thread.join(); }
+}
+
+int main(int argc, char** argv){
+    parseArguments(argc,argv);
+
+    AtomicGenType counter = GenType(0);
+    GenType lockedCounter = GenType(0);
+    std::mutex mutex;
+    std::atomic<int> plainCounter = 0;
+
+    const GenType one(1);
+
+    std::cout << "Hardware threads: " << std::thread::hardware_concurrency() << std::endl;
+    printHeader("Counting threads, " + std::to_string(increments) + " increments each", {"atomic", "mutex", "atomic<int>"});
+    for(std::size_t numberOfThreads: {1, 2, 4, 8}){
+        compare(std::to_string(numberOfThreads) + " threads",
+            [&]{ runThreads(numberOfThreads, [&]{
+                for(std::size_t i = 0; i < increments; ++i){ counter.fetch_add(one); }
+            }); },
+            [&]{ runThreads(numberOfThreads, [&]{
+                for(std::size_t i = 0; i < increments; ++i){
+                    std::lock_guard lock(mutex);
+                    lockedCounter += one;
+                }
+            }); },
+            [&]{ runThreads(numberOfThreads, [&]{
+                for(std::size_t i = 0; i < increments; ++i){ plainCounter.fetch_add(1); }
+            }); }
+        );
+    }
+
+    printHeader("Reading a value", {"atomic", "mutex", "atomic<int>"});
+    compare("load",
+        [&]{ doNotOptimize(counter.load()); },
+        [&]{ std::lock_guard lock(mutex); doNotOptimize(GenType(lockedCounter)); },
+        [&]{ doNotOptimize(plainCounter.load()); }
+    );
+}
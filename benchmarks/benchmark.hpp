@@ -0,0 +1,171 @@
+#pragma once
+
+#include<atomic>
+#include<iostream>
+#include<iomanip>
+#include<chrono>
+#include<string>
+#include<string_view>
+#include<cstddef>
+#include<cstdlib>
+#include<new>
+#include<initializer_list>
+
+// A minimal, dependency free benchmark harness in the spirit of Google Benchmark.
+// Every benchmark executable includes this header exactly once, as it replaces the global
+// allocation functions to count allocations per operation.
+
+//! Number of calls to the global `operator new` and `operator new[]` of any form since program start,
+//! atomic since the benchmarks of the concurrent containers allocate from several threads
+inline std::atomic<std::size_t> allocationCount = 0;
+
+//! Count and perform an allocation, returns nullptr if it fails
+inline void * countedAllocate(std::size_t size) noexcept {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+//! Count and perform an allocation aligned to `alignment`, returns nullptr if it fails
+inline void * countedAllocate(std::size_t size, std::align_val_t alignment) noexcept {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    const std::size_t align = static_cast<std::size_t>(alignment);
+    // the size passed to aligned_alloc has to be a multiple of the alignment
+    return std::aligned_alloc(align, (size == 0 ? 1 : size + align - 1) / align * align);
+}
+
+//! Free an allocation of any form. Not inlined into the replaced `operator delete`s, as GCC would
+//! otherwise warn that `free` releases memory returned by `operator new` (-Wmismatched-new-delete).
+[[gnu::noinline]] inline void countedFree(void * ptr) noexcept {
+    std::free(ptr);
+}
+
+// All forms allocate by malloc or aligned_alloc, so every form of delete frees with countedFree
+void * operator new(std::size_t size){
+    if( void * ptr = countedAllocate(size) ){ return ptr; }
+    throw std::bad_alloc();
+}
+void * operator new[](std::size_t size){
+    if( void * ptr = countedAllocate(size) ){ return ptr; }
+    throw std::bad_alloc();
+}
+void * operator new(std::size_t size, std::align_val_t alignment){
+    if( void * ptr = countedAllocate(size, alignment) ){ return ptr; }
+    throw std::bad_alloc();
+}
+void * operator new[](std::size_t size, std::align_val_t alignment){
+    if( void * ptr = countedAllocate(size, alignment) ){ return ptr; }
+    throw std::bad_alloc();
+}
+void * operator new(std::size_t size, const std::nothrow_t &) noexcept { return countedAllocate(size); }
+void * operator new[](std::size_t size, const std::nothrow_t &) noexcept { return countedAllocate(size); }
+void * operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept { return countedAllocate(size, alignment); }
+void * operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept { return countedAllocate(size, alignment); }
+
+void operator delete(void * ptr) noexcept { countedFree(ptr); }
+void operator delete[](void * ptr) noexcept { countedFree(ptr); }
+void operator delete(void * ptr, std::size_t) noexcept { countedFree(ptr); }
+void operator delete[](void * ptr, std::size_t) noexcept { countedFree(ptr); }
+void operator delete(void * ptr, std::align_val_t) noexcept { countedFree(ptr); }
+void operator delete[](void * ptr, std::align_val_t) noexcept { countedFree(ptr); }
+void operator delete(void * ptr, std::size_t, std::align_val_t) noexcept { countedFree(ptr); }
+void operator delete[](void * ptr, std::size_t, std::align_val_t) noexcept { countedFree(ptr); }
+void operator delete(void * ptr, const std::nothrow_t &) noexcept { countedFree(ptr); }
+void operator delete[](void * ptr, const std::nothrow_t &) noexcept { countedFree(ptr); }
+void operator delete(void * ptr, std::align_val_t, const std::nothrow_t &) noexcept { countedFree(ptr); }
+void operator delete[](void * ptr, std::align_val_t, const std::nothrow_t &) noexcept { countedFree(ptr); }
+
+//! Prevent the compiler from optimizing away the computation of `value`
+template<typename Type>
+inline void doNotOptimize(const Type & value){
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+//! Prevent the compiler from assuming anything about the content of `value`
+template<typename Type>
+inline void doNotOptimize(Type & value){
+    asm volatile("" : "+r,m"(value) : : "memory");
+}
+
+//! Result of a single benchmark run
+struct Measurement {
+    double nsPerOp;
+    double allocsPerOp;
+    std::size_t iterations;
+};
+
+//! Minimal run time of a single benchmark in nano seconds
+inline double minBenchmarkTime = 2e7;
+
+//! Repeatedly call `function` until the accumulated run time exceeds `minBenchmarkTime`
+template<typename Function>
+Measurement measure(Function && function){
+    using clock = std::chrono::steady_clock;
+
+    // warm up caches and branch predictors
+    for(std::size_t i = 0; i < 16; ++i){ function(); }
+
+    std::size_t iterations = 1;
+    while(true){
+        const std::size_t allocationsBefore = allocationCount.load(std::memory_order_relaxed);
+        const auto start = clock::now();
+        for(std::size_t i = 0; i < iterations; ++i){
+            function();
+        }
+        const auto stop = clock::now();
+        const std::size_t allocations = allocationCount.load(std::memory_order_relaxed) - allocationsBefore;
+
+        const double elapsed = std::chrono::duration<double,std::nano>(stop - start).count();
+        if( elapsed >= minBenchmarkTime || iterations >= (std::size_t(1) << 32) ){
+            return {
+                elapsed / double(iterations),
+                double(allocations) / double(iterations),
+                iterations
+            };
+        }
+        iterations *= (elapsed < minBenchmarkTime / 10) ? 10 : 2;
+    }
+}
+
+//! Only benchmarks whose name contains this string are run, set from the command line
+inline std::string benchmarkFilter;
+
+//! Print the header of the comparison table with one time and allocation column per entry of `columns`
+inline void printHeader(
+    std::string_view title,
+    std::initializer_list<std::string_view> columns = {"GenType", "variant", "raw"})
+{
+    std::cout << "\n" << title << "\n" << std::left << std::setw(40) << "Benchmark" << std::right;
+    for(std::string_view column: columns){
+        std::cout << std::setw(20) << (std::string(column) + " ns") << std::setw(10) << "allocs";
+    }
+    std::cout << "\n" << std::string(40 + 30*columns.size(),'-') << std::endl;
+}
+
+//! Benchmark the same operation implemented in different ways, by default on a `GeneralType`, 
+//! a `std::variant` and the plain type, and print one row of the comparison table
+template<typename ... Functions>
+void compare(std::string_view name, Functions && ... functions){
+    if( name.find(benchmarkFilter) == std::string_view::npos ){ return; }
+
+    const Measurement results[] = { measure(functions)... };
+
+    std::cout << std::left << std::setw(40) << name << std::right << std::fixed;
+    for(const Measurement & result: results){
+        std::cout << std::setprecision(2) << std::setw(20) << result.nsPerOp
+                  << std::setprecision(1) << std::setw(10) << result.allocsPerOp;
+    }
+    std::cout << std::endl;
+}
+
+//! Read the benchmark filter and the minimal run time (in ms) from the command line
+inline void parseArguments(int argc, char ** argv){
+    if( argc > 1 ){ benchmarkFilter = argv[1]; }
+    if( argc > 2 ){ minBenchmarkTime = std::atof(argv[2]) * 1e6; }
+}
+
+//! A stream buffer that discards everything, used to benchmark `operator<<` without I/O
+class NullBuffer : public std::streambuf {
+    protected:
+    int overflow(int c) override { return c; }
+    std::streamsize xsputn(const char *, std::streamsize n) override { return n; }
+};
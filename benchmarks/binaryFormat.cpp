@@ -0,0 +1,65 @@
+#include "../BinaryFormat.hpp"
+#include "benchmark.hpp"
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Compares writing GeneralTypes in the binary format with writing them as text by `operator<<`,
+// and reading them back with copying the dictionary, which bounds the speed of any reader.
+
+typedef GeneralType<
+    bool, int, double, std::string, std::vector<double>
+> GenType;
+
+typedef GeneralDict<
+    bool, int, double, std::string, std::vector<double>
+> Dict;
+
+int main(int argc, char** argv){
+    parseArguments(argc,argv);
+
+    // a parameter set of scalars and short strings
+    Dict parameters;
+    for(std::size_t i = 0; i < 100000; ++i){
+        const std::string key = "parameter" + std::to_string(i);
+        switch( i % 4 ){
+            case 0: parameters[key] = int(i); break;
+            case 1: parameters[key] = double(i) * 0.5; break;
+            case 2: parameters[key] = (i % 3 == 0); break;
+            default: parameters[key] = std::string("value") + std::to_string(i); break;
+        }
+    }
+
+    // a single large vector
+    const GenType vector = std::vector<double>(1 << 20, 1.5);
+
+    printHeader("Writing", {"binary", "text"});
+    compare("GeneralDict of 100000 scalars",
+        [&]{ doNotOptimize(toBinary(parameters)); },
+        [&]{
+            std::ostringstream os;
+            for(auto [key,value]: parameters){ os << key << ": " << value << "\n"; }
+            doNotOptimize(os.str());
+        }
+    );
+    compare("vector<double> of 2^20 elements",
+        [&]{ doNotOptimize(toBinary(vector)); },
+        [&]{
+            std::ostringstream os;
+            for(double element: std::vector<double>(GenType(vector))){ os << element << " "; }
+            doNotOptimize(os.str());
+        }
+    );
+
+    const std::vector<std::byte> parameterData = toBinary(parameters);
+    const std::vector<std::byte> vectorData = toBinary(vector);
+    printHeader("Reading", {"binary", "copy"});
+    compare("GeneralDict of 100000 scalars",
+        [&]{ doNotOptimize(fromBinary<Dict>(parameterData)); },
+        [&]{ Dict copy = parameters; doNotOptimize(copy); }
+    );
+    compare("vector<double> of 2^20 elements",
+        [&]{ doNotOptimize(fromBinary<GenType>(vectorData)); },
+        [&]{ GenType copy = vector; doNotOptimize(copy); }
+    );
+}
@@ -0,0 +1,96 @@
+#include "../GeneralType.hpp"
+#include "benchmark.hpp"
+#include <string>
+#include <vector>
+#include <functional>
+#include <random>
+
+// Compares the bulk operators on spans of GeneralTypes, which group the elements by their pair of
+// alternatives and loop over each group, with calling the operator of GenType element by element
+// and with a plain std::vector<double>. With 40 bytes per GenType the large operands do not fit into 
+// the cache and all loops over GenTypes are limited by the memory bandwidth. `convert_all` is
+// compared with converting element by element in the same way.
+
+typedef GeneralType<bool, int, double, std::string> GenType;
+
+//! Operands holding `double`, `int` or randomly one of both
+enum class Operands { Double, Int, Mixed };
+
+std::vector<GenType> makeOperands(Operands operands, std::size_t size, std::mt19937 & rng){
+    std::bernoulli_distribution coin;
+    std::vector<GenType> result;
+    result.reserve(size);
+    for(std::size_t i = 0; i < size; ++i){
+        if( operands == Operands::Double || (operands == Operands::Mixed && coin(rng)) ){
+            result.emplace_back(GenType(double(i) + 0.5));
+        } else {
+            result.emplace_back(GenType(int(i) + 1));
+        }
+    }
+    return result;
+}
+
+template<typename Bulk, typename Operation>
+void compareBulk(std::string_view name, Bulk bulk, Operation op, Operands operands, std::size_t size){
+    std::mt19937 rng(42);
+    const std::vector<GenType> genLhs = makeOperands(operands,size,rng);
+    const std::vector<GenType> genRhs = makeOperands(operands,size,rng);
+    std::vector<GenType> genResult(size);
+    const std::vector<double> rawLhs(size, 1.5);
+    const std::vector<double> rawRhs(size, 2.5);
+    std::vector<double> rawResult(size);
+
+    compare(name,
+        [&]{ bulk(genLhs,genRhs,genResult); doNotOptimize(genResult); },
+        [&]{
+            for(std::size_t i = 0; i < size; ++i){ genResult[i] = op(genLhs[i],genRhs[i]); }
+            doNotOptimize(genResult);
+        },
+        [&]{
+            for(std::size_t i = 0; i < size; ++i){ rawResult[i] = op(rawLhs[i],rawRhs[i]); }
+            doNotOptimize(rawResult);
+        }
+    );
+}
+
+void compareConversion(std::string_view name, Operands operands, std::size_t size){
+    std::mt19937 rng(42);
+    const std::vector<GenType> values = makeOperands(operands,size,rng);
+    const std::vector<int> raw(size, 1);
+    std::vector<double> result(size);
+
+    compare(name,
+        [&]{ convert_all<double>(values,result); doNotOptimize(result); },
+        [&]{
+            for(std::size_t i = 0; i < size; ++i){ result[i] = double(values[i]); }
+            doNotOptimize(result);
+        },
+        [&]{
+            for(std::size_t i = 0; i < size; ++i){ result[i] = double(raw[i]); }
+            doNotOptimize(result);
+        }
+    );
+}
+
+int main(int argc, char** argv){
+    parseArguments(argc,argv);
+
+    // The bulk operators are hidden friends of GenType and can only be passed on wrapped in a lambda
+    auto bulkAdd = [](const auto & lhs, const auto & rhs, auto & result){ return add(lhs,rhs,result); };
+    auto bulkMultiply = [](const auto & lhs, const auto & rhs, auto & result){ return multiply(lhs,rhs,result); };
+    auto bulkCompareSmaller = [](const auto & lhs, const auto & rhs, auto & result){ return compareSmaller(lhs,rhs,result); };
+
+    for(std::size_t size: {std::size_t(1) << 12, std::size_t(1) << 16}){
+        printHeader("Bulk operators on " + std::to_string(size) + " elements", {"bulk", "element wise", "vector<double>"});
+        compareBulk("add (all double)",            bulkAdd,            std::plus<>{},       Operands::Double, size);
+        compareBulk("add (all int)",               bulkAdd,            std::plus<>{},       Operands::Int,    size);
+        compareBulk("add (random int/double)",     bulkAdd,            std::plus<>{},       Operands::Mixed,  size);
+        compareBulk("multiply (all double)",       bulkMultiply,       std::multiplies<>{}, Operands::Double, size);
+        compareBulk("compareSmaller (all double)", bulkCompareSmaller, std::less<>{},       Operands::Double, size);
+
+        printHeader("Conversion to double of " + std::to_string(size) + " elements", {"convert_all", "element wise", "vector<int>"});
+        compareConversion("convert (all double)",        Operands::Double, size);
+        compareConversion("convert (all int)",           Operands::Int,    size);
+        compareConversion("convert (random int/double)", Operands::Mixed,  size);
+    }
+}
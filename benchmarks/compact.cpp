@@ -0,0 +1,74 @@
+#include "../CompactGeneralType.hpp"
+#include "benchmark.hpp"
+#include <string>
+#include <vector>
+
+// Compares arrays of `CompactGeneralType`s, which take 16 bytes per value, with arrays of GeneralTypes,
+// which take the size of the largest alternative. Most values are scalars, every 100th value is a string.
+
+typedef GeneralType<
+    bool, int, double, std::string, std::vector<double>
+> GenType;
+
+typedef CompactGeneralType<
+    bool, int, double, std::string, std::vector<double>
+> Compact;
+
+int main(int argc, char** argv){
+    parseArguments(argc,argv);
+
+    constexpr std::size_t size = 1 << 20;
+    std::vector<GenType> values;
+    for(std::size_t i = 0; i < size; ++i){
+        if( i % 100 == 0 ){
+            values.push_back(GenType(std::string("value") + std::to_string(i)));
+        } else if( i % 2 == 0 ){
+            values.push_back(GenType(int(i)));
+        } else {
+            values.push_back(GenType(double(i) * 0.5));
+        }
+    }
+    const std::vector<Compact> compacts(values.begin(), values.end());
+
+    std::cout << "Bytes per value: " << sizeof(Compact) << " (CompactGeneralType), "
+              << sizeof(GenType) << " (GeneralType)" << std::endl;
+
+    printHeader("1M values", {"CompactGeneralType", "GeneralType"});
+    compare("sum of the doubles",
+        [&]{
+            double sum = 0;
+            for(const Compact & value: compacts){
+                if( value.holds<double>() ){ sum += value.get<double>(); }
+            }
+            doNotOptimize(sum);
+        },
+        [&]{
+            double sum = 0;
+            for(const GenType & value: values){
+                const GeneralTypeView<GenType> view = borrow(value);
+                if( view.holds<double>() ){ sum += view.get<double>(); }
+            }
+            doNotOptimize(sum);
+        }
+    );
+    compare("sum through borrow",
+        [&]{
+            GenType sum = 0.0;
+            for(const Compact & value: compacts){
+                if( !value.holds<std::string>() ){ borrow(sum) += borrow(value); }
+            }
+            doNotOptimize(sum);
+        },
+        [&]{
+            GenType sum = 0.0;
+            for(const GenType & value: values){
+                if( !borrow(value).holds<std::string>() ){ borrow(sum) += value; }
+            }
+            doNotOptimize(sum);
+        }
+    );
+    compare("copy the array",
+        [&]{ doNotOptimize(std::vector<Compact>(compacts)); },
+        [&]{ doNotOptimize(std::vector<GenType>(values)); }
+    );
+}
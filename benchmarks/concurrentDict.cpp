@@ -0,0 +1,119 @@
+#include "../ConcurrentGeneralDict.hpp"
+#include "benchmark.hpp"
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Measures how lookups in a shared dictionary scale with the number of reading threads. The
+// ConcurrentGeneralDict is compared with a GeneralDict behind a global std::mutex and behind a global
+// std::shared_mutex. Every thread looks up `lookups` keys, a row reports the time until all threads
+// are done, so perfect scaling keeps the time constant while the number of threads grows.
+// A second table adds a writer that updates values all the time.
+
+typedef GeneralType<
+    bool, int, double, std::string
+> GenType;
+
+typedef GeneralDict<
+    bool, int, double, std::string
+> Dict;
+
+typedef ConcurrentGeneralDict<
+    bool, int, double, std::string
+> SharedDict;
+
+//! Number of entries of the dictionaries
+constexpr std::size_t numberOfKeys = 10000;
+
+//! Number of lookups per thread and benchmark iteration
+constexpr std::size_t lookups = 100000;
+
+//! Run `function(thread)` on `numberOfThreads` threads and wait for all of them
+template<typename Function>
+void runThreads(std::size_t numberOfThreads, Function && function){
+    std::vector<std::thread> threads;
+    threads.reserve(numberOfThreads);
+    for(std::size_t t = 0; t < numberOfThreads; ++t){
+        threads.emplace_back(function, t);
+    }
+    for(std::thread & thread: threads){ thread.join(); }
+}
+
+int main(int argc, char** argv){
+    parseArguments(argc,argv);
+
+    std::vector<std::string> keys;
+    Dict dict;
+    SharedDict sharedDict;
+    for(std::size_t i = 0; i < numberOfKeys; ++i){
+        keys.push_back("parameter" + std::to_string(i));
+        dict[keys.back()] = double(i);
+        sharedDict.insert_or_assign(keys.back(), double(i));
+    }
+    std::mutex mutex;
+    std::shared_mutex sharedMutex;
+
+    //! Look up `lookups` keys starting at a different key in every thread
+    auto concurrentLookups = [&](std::size_t thread){
+        double sum = 0;
+        for(std::size_t i = 0; i < lookups; ++i){
+            sharedDict.visit(keys[(thread * 7919 + i) % numberOfKeys], [&sum](const GenType & value){ sum += *value.get_if<double>(); });
+        }
+        doNotOptimize(sum);
+    };
+    auto mutexLookups = [&](std::size_t thread){
+        double sum = 0;
+        for(std::size_t i = 0; i < lookups; ++i){
+            std::lock_guard lock(mutex);
+            sum += *dict.find(keys[(thread * 7919 + i) % numberOfKeys])->second.get_if<double>();
+        }
+        doNotOptimize(sum);
+    };
+    auto sharedMutexLookups = [&](std::size_t thread){
+        double sum = 0;
+        for(std::size_t i = 0; i < lookups; ++i){
+            std::shared_lock lock(sharedMutex);
+            sum += *dict.find(keys[(thread * 7919 + i) % numberOfKeys])->second.get_if<double>();
+        }
+        doNotOptimize(sum);
+    };
+
+    std::cout << "Hardware threads: " << std::thread::hardware_concurrency() << std::endl;
+    printHeader("Reading threads, " + std::to_string(lookups) + " lookups each", {"concurrent", "mutex", "shared_mutex"});
+    for(std::size_t numberOfThreads: {1, 2, 4, 8}){
+        compare(std::to_string(numberOfThreads) + " threads",
+            [&]{ runThreads(numberOfThreads, concurrentLookups); },
+            [&]{ runThreads(numberOfThreads, mutexLookups); },
+            [&]{ runThreads(numberOfThreads, sharedMutexLookups); }
+        );
+    }
+
+    printHeader("Reading threads and one writer, " + std::to_string(lookups) + " operations each", {"concurrent", "mutex", "shared_mutex"});
+    for(std::size_t numberOfThreads: {2, 4, 8}){
+        // the last thread writes instead of reading
+        compare(std::to_string(numberOfThreads) + " threads",
+            [&]{ runThreads(numberOfThreads, [&](std::size_t thread){
+                if( thread + 1 < numberOfThreads ){ return concurrentLookups(thread); }
+                for(std::size_t i = 0; i < lookups; ++i){
+                    sharedDict.modify(keys[i % numberOfKeys], [](GenType & value){ value += GenType(1.0); });
+                }
+            }); },
+            [&]{ runThreads(numberOfThreads, [&](std::size_t thread){
+                if( thread + 1 < numberOfThreads ){ return mutexLookups(thread); }
+                for(std::size_t i = 0; i < lookups; ++i){
+                    std::lock_guard lock(mutex);
+                    dict.find(keys[i % numberOfKeys])->second += GenType(1.0);
+                }
+            }); },
+            [&]{ runThreads(numberOfThreads, [&](std::size_t thread){
+                if( thread + 1 < numberOfThreads ){ return sharedMutexLookups(thread); }
+                for(std::size_t i = 0; i < lookups; ++i){
+                    std::unique_lock lock(sharedMutex);
+                    dict.find(keys[i % numberOfKeys])->second += GenType(1.0);
+                }
+            }); }
+        );
+    }
+}
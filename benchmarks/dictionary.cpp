@@ -0,0 +1,114 @@
+#include "../GeneralDict.hpp"
+#include "benchmark.hpp"
+#include <map>
+#include <unordered_map>
+#include <string>
+#include <vector>
+
+// Compares the lookup and insertion of parameters in a `GeneralDict` with the
+// `std::map<std::string,GenType>` of Examples/dictionary.cpp and a `std::unordered_map`, as well
+// as the lookup by a string, a precomputed `DictKey` and an interned `Handle`.
+
+typedef GeneralType<
+    bool, int, double, std::string
+> GenType;
+
+typedef GeneralDict<
+    bool, int, double, std::string
+> Dict;
+
+typedef std::map<std::string,GenType> Map;
+typedef std::unordered_map<std::string,GenType> UnorderedMap;
+
+//! Keys of the form "parameter/<i>", long keys are allocated on the heap by std::string
+std::vector<std::string> makeKeys(std::size_t count, std::size_t padding){
+    std::vector<std::string> keys;
+    for(std::size_t i = 0; i < count; ++i){
+        keys.push_back("p" + std::string(padding,'_') + std::to_string(i));
+    }
+    return keys;
+}
+
+//! Benchmark looking up all `keys` one after the other
+void compareLookup(std::string_view name, const std::vector<std::string> & keys){
+    Dict dict;
+    Map map;
+    UnorderedMap unorderedMap;
+    for(std::size_t i = 0; i < keys.size(); ++i){
+        dict[keys[i]] = int(i);
+        map[keys[i]] = int(i);
+        unorderedMap[keys[i]] = int(i);
+    }
+
+    std::size_t next = 0;
+    compare(name,
+        [&]{ doNotOptimize(dict.at(keys[next])); next = (next + 1) % keys.size(); },
+        [&]{ doNotOptimize(map.at(keys[next])); next = (next + 1) % keys.size(); },
+        [&]{ doNotOptimize(unorderedMap.at(keys[next])); next = (next + 1) % keys.size(); }
+    );
+}
+
+//! Benchmark filling a dictionary with all `keys`
+void compareInsertion(std::string_view name, const std::vector<std::string> & keys){
+    compare(name,
+        [&]{
+            Dict dict;
+            for(std::size_t i = 0; i < keys.size(); ++i){ dict[keys[i]] = int(i); }
+            doNotOptimize(dict);
+        },
+        [&]{
+            Map map;
+            for(std::size_t i = 0; i < keys.size(); ++i){ map[keys[i]] = int(i); }
+            doNotOptimize(map);
+        },
+        [&]{
+            UnorderedMap unorderedMap;
+            for(std::size_t i = 0; i < keys.size(); ++i){ unorderedMap[keys[i]] = int(i); }
+            doNotOptimize(unorderedMap);
+        }
+    );
+}
+
+int main(int argc, char** argv){
+    parseArguments(argc,argv);
+
+    const std::vector<std::string> fewKeys = makeKeys(16, 4);
+    const std::vector<std::string> manyKeys = makeKeys(10000, 4);
+    const std::vector<std::string> longKeys = makeKeys(10000, 24);
+
+    printHeader("Lookup of a single key", {"GeneralDict", "std::map", "unordered_map"});
+    compareLookup("at(), 16 short keys", fewKeys);
+    compareLookup("at(), 10000 short keys", manyKeys);
+    compareLookup("at(), 10000 long keys", longKeys);
+
+    Dict dict = {{"key1", true}, {"key2", 1.235}, {"key3", 2}};
+    Map map = {{"key1", true}, {"key2", 1.235}, {"key3", 2}};
+    UnorderedMap unorderedMap = {{"key1", true}, {"key2", 1.235}, {"key3", 2}};
+    compare("at(\"key2\"), string literal",
+        [&]{ doNotOptimize(dict.at("key2")); },
+        [&]{ doNotOptimize(map.at("key2")); },
+        [&]{ doNotOptimize(unorderedMap.at("key2")); }
+    );
+
+    printHeader("Lookup of \"key2\" by", {"string_view", "DictKey", "Handle"});
+    constexpr DictKey key2 = "key2"_key;
+    const Dict::Handle handle2 = dict.intern("key2");
+    compare("3 keys",
+        [&]{ doNotOptimize(dict.at("key2")); },
+        [&]{ doNotOptimize(dict.at(key2)); },
+        [&]{ doNotOptimize(dict[handle2]); }
+    );
+    Dict manyDict;
+    for(std::size_t i = 0; i < manyKeys.size(); ++i){ manyDict[manyKeys[i]] = int(i); }
+    manyDict["key2"] = 1.235;
+    const Dict::Handle manyHandle2 = manyDict.intern("key2");
+    compare("10001 keys",
+        [&]{ doNotOptimize(manyDict.at("key2")); },
+        [&]{ doNotOptimize(manyDict.at(key2)); },
+        [&]{ doNotOptimize(manyDict[manyHandle2]); }
+    );
+
+    printHeader("Insertion of all keys into an empty dictionary", {"GeneralDict", "std::map", "unordered_map"});
+    compareInsertion("operator[], 16 short keys", fewKeys);
+    compareInsertion("operator[], 10000 short keys", manyKeys);
+}
@@ -0,0 +1,102 @@
+#include "../GeneralType.hpp"
+#include "benchmark.hpp"
+#include <complex>
+#include <vector>
+#include <functional>
+#include <random>
+
+// Compares the dispatch of the binary operators of GenType, a flat table indexed by the pair of
+// held alternatives, with the nested std::visit used previously. To defeat the branch predictor
+// the operands randomly hold one of bool, int, float or double.
+
+// The same type list as in Examples/basicUsage.cpp
+typedef GeneralType<
+    bool,int,
+    float,double,
+    std::complex<float>,std::complex<double>,
+    std::vector<bool>, std::vector<int>,std::vector<float>,std::vector<double>,
+    std::vector<std::complex<float>>,std::vector<std::complex<double>>,
+    double*
+> GenType;
+
+// The std::variant that is held inside of GenType
+typedef std::variant<
+    long int,
+    bool,int,
+    float,double,
+    std::complex<float>,std::complex<double>,
+    std::vector<bool>, std::vector<int>,std::vector<float>,std::vector<double>,
+    std::vector<std::complex<float>>,std::vector<std::complex<double>>,
+    double*
+> Variant;
+
+//! The previous implementation of the binary operators: a std::visit nested in a std::visit
+template<typename Operation>
+Variant nestedVisit(Operation op, const Variant & lhs, const Variant & rhs){
+    return std::visit(
+        [&op,&rhs](const auto & lhs_arg){
+            return std::visit(
+                [&op,&lhs_arg](const auto & rhs_arg) -> Variant {
+                    if constexpr( requires { Variant(op(lhs_arg,rhs_arg)); } ){
+                        return Variant(op(lhs_arg,rhs_arg));
+                    } else {
+                        throw std::runtime_error("Unsupported binary operation");
+                    }
+                },
+                rhs
+            );
+        },
+        lhs
+    );
+}
+
+//! Number of operands per benchmark iteration
+constexpr std::size_t size = 1024;
+
+//! Random operands holding bool, int, float or double
+template<typename Type>
+std::vector<Type> randomOperands(std::mt19937 & rng){
+    std::uniform_int_distribution<int> alternative(0,3);
+    std::vector<Type> operands;
+    operands.reserve(size);
+    for(std::size_t i = 0; i < size; ++i){
+        switch( alternative(rng) ){
+            case 0: operands.emplace_back(Type(true)); break;
+            case 1: operands.emplace_back(Type(int(i+1))); break;
+            case 2: operands.emplace_back(Type(float(i+1)*0.5f)); break;
+            default: operands.emplace_back(Type(double(i+1)*0.25)); break;
+        }
+    }
+    return operands;
+}
+
+template<typename Operation>
+void compareDispatch(std::string_view name, Operation op){
+    std::mt19937 rngLhs(42), rngRhs(1337);
+    const std::vector<GenType> genLhs = randomOperands<GenType>(rngLhs);
+    const std::vector<GenType> genRhs = randomOperands<GenType>(rngRhs);
+    rngLhs.seed(42); rngRhs.seed(1337);
+    const std::vector<Variant> varLhs = randomOperands<Variant>(rngLhs);
+    const std::vector<Variant> varRhs = randomOperands<Variant>(rngRhs);
+    const std::vector<double> rawLhs(size, 1.5);
+    const std::vector<double> rawRhs(size, 2.5);
+
+    compare(name,
+        [&]{ for(std::size_t i = 0; i < size; ++i){ doNotOptimize(op(genLhs[i],genRhs[i])); } },
+        [&]{ for(std::size_t i = 0; i < size; ++i){ doNotOptimize(nestedVisit(op,varLhs[i],varRhs[i])); } },
+        [&]{ for(std::size_t i = 0; i < size; ++i){ doNotOptimize(op(rawLhs[i],rawRhs[i])); } }
+    );
+}
+
+int main(int argc, char** argv){
+    parseArguments(argc,argv);
+
+    printHeader("Binary operator dispatch, 1024 random {bool,int,float,double} pairs per op\n"
+                "(GenType: flat dispatch table, variant: nested std::visit, raw: double)");
+    compareDispatch("operator+",  std::plus<>{});
+    compareDispatch("operator-",  std::minus<>{});
+    compareDispatch("operator*",  std::multiplies<>{});
+    compareDispatch("operator/",  std::divides<>{});
+    compareDispatch("operator<",  std::less<>{});
+    compareDispatch("operator==", std::equal_to<>{});
+}
@@ -0,0 +1,73 @@
+#include "../GeneralExpression.hpp"
+#include "benchmark.hpp"
+#include <complex>
+#include <vector>
+
+// Compares chains of arithmetic operators evaluated eagerly, creating an intermediate GenType per
+// operator, with the same chain started by `lazy`, and with a plain loop doing the same work.
+
+// The same type list as in Examples/basicUsage.cpp
+typedef GeneralType<
+    bool,int,
+    float,double,
+    std::complex<float>,std::complex<double>,
+    std::vector<bool>, std::vector<int>,std::vector<float>,std::vector<double>,
+    std::vector<std::complex<float>>,std::vector<std::complex<double>>,
+    double*
+> GenType;
+
+//! Benchmark `a * b + c - d` on vectors of `size` elements
+void compareVectors(std::size_t size){
+    std::vector<double> a(size), b(size), c(size);
+    for(std::size_t i = 0; i < size; ++i){
+        a[i] = double(i) * 0.5;
+        b[i] = double(size - i);
+        c[i] = double(i % 7);
+    }
+    const GenType genA = std::as_const(a);
+    const GenType genB = std::as_const(b);
+    const GenType genC = std::as_const(c);
+    const GenType genD = 2.0;
+
+    const std::string name = "a * b + c - 2.0, " + std::to_string(size) + " elements";
+    compare(name,
+        [&]{ doNotOptimize(GenType(genA * genB + genC - genD)); },
+        [&]{ doNotOptimize(GenType(lazy(genA) * genB + genC - genD)); },
+        [&]{
+            std::vector<double> result(size);
+            for(std::size_t i = 0; i < size; ++i){ result[i] = a[i] * b[i] + c[i] - 2.0; }
+            doNotOptimize(result);
+        }
+    );
+}
+
+int main(int argc, char** argv){
+    parseArguments(argc,argv);
+
+    printHeader("Chained operators", {"eager", "lazy", "raw"});
+
+    const GenType a = 1.5, b = 2.5, c = 0.5, d = 3.0;
+    double rawA = 1.5, rawB = 2.5, rawC = 0.5, rawD = 3.0;
+    compare("a * b + c - d, double",
+        [&]{ doNotOptimize(GenType(a * b + c - d)); },
+        [&]{ doNotOptimize(GenType(lazy(a) * b + c - d)); },
+        [&]{
+            doNotOptimize(rawA); doNotOptimize(rawB); doNotOptimize(rawC); doNotOptimize(rawD);
+            doNotOptimize(rawA * rawB + rawC - rawD);
+        }
+    );
+
+    const GenType i = 3;
+    int rawI = 3;
+    compare("i * b + c - d, int and double",
+        [&]{ doNotOptimize(GenType(i * b + c - d)); },
+        [&]{ doNotOptimize(GenType(lazy(i) * b + c - d)); },
+        [&]{
+            doNotOptimize(rawI); doNotOptimize(rawB); doNotOptimize(rawC); doNotOptimize(rawD);
+            doNotOptimize(rawI * rawB + rawC - rawD);
+        }
+    );
+
+    compareVectors(4096);
+    compareVectors(65536);
+}
@@ -0,0 +1,49 @@
+#include "../GeneralTypeRef.hpp"
+#include "benchmark.hpp"
+#include <vector>
+
+// Compares access through a `GeneralTypeRef` with the operators of the GeneralType, which copy
+// the accessed element or the held vector into a new GeneralType.
+
+typedef GeneralType<
+    bool, int, double, std::vector<double>, std::string
+> GenType;
+
+int main(int argc, char** argv){
+    parseArguments(argc,argv);
+
+    GenType VECTOR = std::vector<double>(1024, 1.0);
+    GenType ONE = 1.0;
+    std::size_t next = 0;
+
+    printHeader("Access", {"GeneralTypeRef", "GeneralType"});
+    compare("read an element",
+        [&]{ doNotOptimize(borrow(VECTOR)[next = (next + 1) % 1024].get<double>()); },
+        [&]{ doNotOptimize(double(VECTOR[next = (next + 1) % 1024])); }
+    );
+    compare("increment an element",
+        [&]{ borrow(VECTOR)[next = (next + 1) % 1024] += ONE; },
+        [&]{
+            next = (next + 1) % 1024;
+            std::vector<double> elements = VECTOR;
+            elements[next] += 1.0;
+            VECTOR = std::move(elements);
+        }
+    );
+    compare("sum of a vector",
+        [&]{
+            double sum = 0;
+            for(double element: borrow(VECTOR).span<double>()){ sum += element; }
+            doNotOptimize(sum);
+        },
+        [&]{
+            double sum = 0;
+            for(double element: std::vector<double>(VECTOR)){ sum += element; }
+            doNotOptimize(sum);
+        }
+    );
+    compare("vector += double",
+        [&]{ borrow(VECTOR) += ONE; doNotOptimize(VECTOR); },
+        [&]{ VECTOR += ONE; doNotOptimize(VECTOR); }
+    );
+}
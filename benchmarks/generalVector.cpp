@@ -0,0 +1,64 @@
+#include "../GeneralVector.hpp"
+#include "benchmark.hpp"
+#include <string>
+#include <vector>
+#include <functional>
+
+// Compares element wise operators on a GeneralVector, which dispatches once per run,
+// with a std::vector of GeneralTypes, which dispatches once per element, and a plain
+// std::vector<double>.
+
+typedef GeneralType<bool, int, double, std::string> GenType;
+typedef GeneralVector<bool, int, double, std::string> GenVector;
+
+//! Number of elements per operand
+constexpr std::size_t size = 1 << 16;
+
+template<typename Operation>
+void compareElementwise(std::string_view name, Operation op, std::size_t runLength){
+    GenVector genVecLhs, genVecRhs;
+    std::vector<GenType> vecGenLhs, vecGenRhs;
+    std::vector<double> rawLhs, rawRhs;
+    for(std::size_t i = 0; i < size; ++i){
+        // switch between double and int every `runLength` elements
+        if( (i / runLength) % 2 == 0 ){
+            genVecLhs.push_back(double(i) + 0.5);
+            vecGenLhs.push_back(GenType(double(i) + 0.5));
+        } else {
+            genVecLhs.push_back(int(i));
+            vecGenLhs.push_back(GenType(int(i)));
+        }
+        genVecRhs.push_back(1.5);
+        vecGenRhs.push_back(GenType(1.5));
+        rawLhs.push_back(double(i) + 0.5);
+        rawRhs.push_back(1.5);
+    }
+    std::vector<GenType> vecGenResult(size);
+    std::vector<double> rawResult(size);
+
+    compare(name,
+        [&]{ doNotOptimize(op(genVecLhs,genVecRhs)); },
+        [&]{
+            for(std::size_t i = 0; i < size; ++i){ vecGenResult[i] = op(vecGenLhs[i],vecGenRhs[i]); }
+            doNotOptimize(vecGenResult);
+        },
+        [&]{
+            for(std::size_t i = 0; i < size; ++i){ rawResult[i] = op(rawLhs[i],rawRhs[i]); }
+            doNotOptimize(rawResult);
+        }
+    );
+}
+
+int main(int argc, char** argv){
+    parseArguments(argc,argv);
+
+    printHeader("Element wise operators on 65536 elements", {"GeneralVector", "vector<GenType>", "vector<double>"});
+    compareElementwise("operator+ (all double)",   std::plus<>{},       size);
+    compareElementwise("operator+ (runs of 1024)", std::plus<>{},       1024);
+    compareElementwise("operator+ (runs of 16)",   std::plus<>{},       16);
+    compareElementwise("operator* (all double)",   std::multiplies<>{}, size);
+    compareElementwise("operator< (all double)",   std::less<>{},       size);
+
+    std::cout << "\nMemory per element: GenType " << sizeof(GenType) 
+              << " bytes, GeneralVector of doubles " << sizeof(double) << " bytes" << std::endl;
+}
@@ -0,0 +1,94 @@
+#include "../JsonFormat.hpp"
+#include "../BinaryFormat.hpp"
+#include "benchmark.hpp"
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Measures reading JSON documents into a GeneralDict and compares it with reading the same
+// dictionary from the binary format. The sizes of the documents are printed to compute the throughput.
+// Writing the dictionaries is compared with writing them by `operator<<`, which can not write vectors.
+
+typedef GeneralType<
+    bool, int, double, std::string, std::vector<double>
+> GenType;
+
+typedef GeneralDict<
+    bool, int, double, std::string, std::vector<double>
+> Dict;
+
+int main(int argc, char** argv){
+    parseArguments(argc,argv);
+
+    // a parameter set of scalars and short strings
+    std::string parameters = "{";
+    for(std::size_t i = 0; i < 100000; ++i){
+        parameters += (i == 0 ? "\n  \"parameter" : ",\n  \"parameter") + std::to_string(i) + "\": ";
+        switch( i % 4 ){
+            case 0: parameters += std::to_string(i); break;
+            case 1: parameters += std::to_string(double(i) * 0.37); break;
+            case 2: parameters += (i % 3 == 0) ? "true" : "false"; break;
+            default: parameters += "\"value" + std::to_string(i) + "\""; break;
+        }
+    }
+    parameters += "\n}";
+
+    // a few large arrays of numbers
+    std::string fields = "{";
+    for(std::size_t i = 0; i < 8; ++i){
+        fields += (i == 0 ? "\"field" : ", \"field") + std::to_string(i) + "\": [";
+        for(std::size_t k = 0; k < 100000; ++k){
+            fields += (k == 0 ? "" : ", ") + std::to_string(double(k) * 0.001 + double(i));
+        }
+        fields += "]";
+    }
+    fields += "}";
+
+    std::cout << "Documents of " << parameters.size() / 1e6 << " MB (parameters) and "
+              << fields.size() / 1e6 << " MB (fields)" << std::endl;
+
+    const std::vector<std::byte> parameterData = toBinary(fromJson<Dict>(parameters));
+    const std::vector<std::byte> fieldData = toBinary(fromJson<Dict>(fields));
+    printHeader("Reading", {"fromJson", "fromBinary"});
+    compare("100000 scalars",
+        [&]{ doNotOptimize(fromJson<Dict>(parameters)); },
+        [&]{ doNotOptimize(fromBinary<Dict>(parameterData)); }
+    );
+    compare("8 arrays of 100000 numbers",
+        [&]{ doNotOptimize(fromJson<Dict>(fields)); },
+        [&]{ doNotOptimize(fromBinary<Dict>(fieldData)); }
+    );
+
+    const Dict parameterDict = fromJson<Dict>(parameters);
+    const Dict fieldDict = fromJson<Dict>(fields);
+    std::string out;
+    printHeader("Writing", {"toJson", "operator<<"});
+    compare("100000 scalars",
+        [&]{
+            out.clear();
+            toJson(parameterDict, out);
+            doNotOptimize(out.data());
+        },
+        [&]{
+            std::ostringstream os;
+            for(const auto & [key,value]: parameterDict){ os << key << ": " << value << "\n"; }
+            doNotOptimize(os.str().data());
+        }
+    );
+    compare("8 arrays of 100000 numbers",
+        [&]{
+            out.clear();
+            toJson(fieldDict, out);
+            doNotOptimize(out.data());
+        },
+        [&]{
+            std::ostringstream os;
+            for(const auto & [key,value]: fieldDict){
+                os << key << ":";
+                for(double element: std::vector<double>(GenType(value))){ os << " " << element; }
+                os << "\n";
+            }
+            doNotOptimize(os.str().data());
+        }
+    );
+}
@@ -0,0 +1,61 @@
+#include "../GeneralType.hpp"
+#include "../MemoryResource.hpp"
+#include "benchmark.hpp"
+#include <string>
+#include <vector>
+
+// Compares operators creating temporary strings and vectors with the global allocator and with scoped
+// allocators allocating from a monotonic arena, which is released after every request.
+
+typedef GeneralType<
+    bool, int, double, std::string, std::vector<double>
+> GenType;
+
+typedef GeneralType<
+    bool, int, double, ScopedString, ScopedVector<double>
+> ScopedGenType;
+
+int main(int argc, char** argv){
+    parseArguments(argc,argv);
+
+    // release() returns to the start of the initial buffer, which is reused by every request
+    std::vector<std::byte> buffer(1 << 20);
+    std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size());
+
+    const GenType NAME = std::string("a name that is too long for the small string buffer");
+    const GenType VECTOR = std::vector<double>(256, 1.5);
+    const GenType TWO = 2.0;
+
+    // the operands live on the heap, only the temporaries are created in the arena
+    const ScopedGenType SCOPED_NAME = ScopedString("a name that is too long for the small string buffer");
+    const ScopedGenType SCOPED_VECTOR = ScopedVector<double>(256, 1.5);
+    const ScopedGenType SCOPED_TWO = 2.0;
+    const MemoryResourceScope scope(arena);
+
+    printHeader("Request of temporaries", {"arena", "global allocator"});
+    compare("string + string + string",
+        [&]{
+            doNotOptimize(SCOPED_NAME + SCOPED_NAME + SCOPED_NAME);
+            arena.release();
+        },
+        [&]{ doNotOptimize(NAME + NAME + NAME); }
+    );
+    compare("(vector + 2) * vector - vector",
+        [&]{
+            doNotOptimize((SCOPED_VECTOR + SCOPED_TWO) * SCOPED_VECTOR - SCOPED_VECTOR);
+            arena.release();
+        },
+        [&]{ doNotOptimize((VECTOR + TWO) * VECTOR - VECTOR); }
+    );
+    compare("64 copies of a vector",
+        [&]{
+            const std::vector<ScopedGenType> copies(64, SCOPED_VECTOR);
+            doNotOptimize(copies.data());
+            arena.release();
+        },
+        [&]{
+            const std::vector<GenType> copies(64, VECTOR);
+            doNotOptimize(copies.data());
+        }
+    );
+}
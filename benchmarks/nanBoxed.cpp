@@ -0,0 +1,65 @@
+#include "../NanBoxedGeneralType.hpp"
+#include "benchmark.hpp"
+#include <vector>
+
+// Compares arrays of scalars stored as `NanBoxedGeneralType`s (8 bytes), `CompactGeneralType`s (16 bytes)
+// and GeneralTypes. Half of the values are doubles, the others ints and bools.
+
+typedef GeneralType<
+    bool, int, double
+> GenType;
+
+typedef BasicNanBoxedGeneralType<GenType> NanBoxed;
+typedef BasicCompactGeneralType<GenType> Compact;
+
+template<typename Value>
+double sumOfDoubles(const std::vector<Value> & values){
+    double sum = 0;
+    for(const Value & value: values){
+        if( value.template holds<double>() ){ sum += value.template get<double>(); }
+    }
+    return sum;
+}
+
+int main(int argc, char** argv){
+    parseArguments(argc,argv);
+
+    constexpr std::size_t size = 1 << 20;
+    std::vector<GenType> values;
+    for(std::size_t i = 0; i < size; ++i){
+        switch( i % 4 ){
+            case 0: values.push_back(GenType(int(i))); break;
+            case 1: values.push_back(GenType(i % 3 == 0)); break;
+            default: values.push_back(GenType(double(i) * 0.5)); break;
+        }
+    }
+    const std::vector<NanBoxed> boxed(values.begin(), values.end());
+    const std::vector<Compact> compacts(values.begin(), values.end());
+
+    std::cout << "Bytes per value: " << sizeof(NanBoxed) << " (NanBoxedGeneralType), " << sizeof(Compact)
+              << " (CompactGeneralType), " << sizeof(GenType) << " (GeneralType)" << std::endl;
+
+    printHeader("1M values", {"NanBoxed", "Compact", "GeneralType"});
+    compare("sum of the doubles",
+        [&]{ doNotOptimize(sumOfDoubles(boxed)); },
+        [&]{ doNotOptimize(sumOfDoubles(compacts)); },
+        [&]{
+            double sum = 0;
+            for(const GenType & value: values){
+                const GeneralTypeView<GenType> view = borrow(value);
+                if( view.holds<double>() ){ sum += view.get<double>(); }
+            }
+            doNotOptimize(sum);
+        }
+    );
+    compare("copy the array",
+        [&]{ doNotOptimize(std::vector<NanBoxed>(boxed)); },
+        [&]{ doNotOptimize(std::vector<Compact>(compacts)); },
+        [&]{ doNotOptimize(std::vector<GenType>(values)); }
+    );
+    compare("convert to GeneralTypes",
+        [&]{ doNotOptimize(std::vector<GenType>(boxed.begin(), boxed.end())); },
+        [&]{ doNotOptimize(std::vector<GenType>(compacts.begin(), compacts.end())); },
+        [&]{ doNotOptimize(std::vector<GenType>(values)); }
+    );
+}
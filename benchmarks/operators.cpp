@@ -0,0 +1,308 @@
+#include "../GeneralType.hpp"
+#include "benchmark.hpp"
+#include <complex>
+#include <vector>
+#include <functional>
+#include <utility>
+
+// The same type list as in Examples/basicUsage.cpp
+typedef GeneralType<
+    bool,int,
+    float,double,
+    std::complex<float>,std::complex<double>,
+    std::vector<bool>, std::vector<int>,std::vector<float>,std::vector<double>,
+    std::vector<std::complex<float>>,std::vector<std::complex<double>>,
+    double*
+> GenType;
+
+// The std::variant that is held inside of GenType, used as baseline
+typedef std::variant<
+    long int,
+    bool,int,
+    float,double,
+    std::complex<float>,std::complex<double>,
+    std::vector<bool>, std::vector<int>,std::vector<float>,std::vector<double>,
+    std::vector<std::complex<float>>,std::vector<std::complex<double>>,
+    double*
+> Variant;
+
+// =========================================================================================
+// Baseline: the operators implemented directly on the std::variant
+// =========================================================================================
+
+//! Apply a unary operation to the value held by `var`
+template<typename Operation>
+Variant visitUnary(Operation op, Variant & var){
+    return std::visit(
+        [&op](auto & arg) -> Variant {
+            if constexpr( requires { Variant(op(arg)); } ){
+                return Variant(op(arg));
+            } else {
+                throw std::runtime_error("Unsupported unary operation");
+            }
+        },
+        var
+    );
+}
+
+//! Apply a binary operation to the values held by `lhs` and `rhs`
+template<typename Operation>
+Variant visitBinary(Operation op, const Variant & lhs, const Variant & rhs){
+    return std::visit(
+        [&op,&rhs](const auto & lhs_arg){
+            return std::visit(
+                [&op,&lhs_arg](const auto & rhs_arg) -> Variant {
+                    if constexpr( requires { Variant(op(lhs_arg,rhs_arg)); } ){
+                        return Variant(op(lhs_arg,rhs_arg));
+                    } else {
+                        throw std::runtime_error("Unsupported binary operation");
+                    }
+                },
+                rhs
+            );
+        },
+        lhs
+    );
+}
+
+//! Apply a binary operation to a plain `lhs` and the value held by `rhs`
+template<typename Operation, typename Type>
+Variant visitMixed(Operation op, const Type & lhs, const Variant & rhs){
+    return std::visit(
+        [&op,&lhs](const auto & rhs_arg) -> Variant {
+            if constexpr( requires { Variant(op(lhs,rhs_arg)); } ){
+                return Variant(op(lhs,rhs_arg));
+            } else {
+                throw std::runtime_error("Unsupported binary operation");
+            }
+        },
+        rhs
+    );
+}
+
+//! Apply a compound assignment to the values held by `lhs` and `rhs`
+template<typename Operation>
+void visitAssign(Operation op, Variant & lhs, const Variant & rhs){
+    std::visit(
+        [&op,&rhs](auto & lhs_arg){
+            std::visit(
+                [&op,&lhs_arg](const auto & rhs_arg){
+                    if constexpr( requires { op(lhs_arg,rhs_arg); } ){
+                        op(lhs_arg,rhs_arg);
+                    } else {
+                        throw std::runtime_error("Unsupported compound assignment");
+                    }
+                },
+                rhs
+            );
+        },
+        lhs
+    );
+}
+
+// =========================================================================================
+// Comparison drivers
+// =========================================================================================
+
+template<typename Operation, typename Type>
+void compareUnary(std::string_view name, Operation op, Type value){
+    GenType genT = std::as_const(value);
+    Variant var = value;
+    compare(name,
+        [&]{ doNotOptimize(genT); doNotOptimize(op(genT)); },
+        [&]{ doNotOptimize(var); doNotOptimize(visitUnary(op,var)); },
+        [&]{ doNotOptimize(value); doNotOptimize(op(value)); }
+    );
+}
+
+template<typename Operation, typename LhsType, typename RhsType>
+void compareBinary(std::string_view name, Operation op, LhsType lhs, RhsType rhs){
+    GenType genLhs = std::as_const(lhs);
+    GenType genRhs = std::as_const(rhs);
+    Variant varLhs = lhs;
+    Variant varRhs = rhs;
+    compare(name,
+        [&]{ doNotOptimize(genLhs); doNotOptimize(genRhs); doNotOptimize(op(genLhs,genRhs)); },
+        [&]{ doNotOptimize(varLhs); doNotOptimize(varRhs); doNotOptimize(visitBinary(op,varLhs,varRhs)); },
+        [&]{ doNotOptimize(lhs); doNotOptimize(rhs); doNotOptimize(op(lhs,rhs)); }
+    );
+}
+
+template<typename Operation, typename LhsType, typename RhsType>
+void compareMixed(std::string_view name, Operation op, LhsType lhs, RhsType rhs){
+    GenType genRhs = std::as_const(rhs);
+    Variant varRhs = rhs;
+    compare(name,
+        [&]{ doNotOptimize(lhs); doNotOptimize(genRhs); doNotOptimize(op(lhs,std::as_const(genRhs))); },
+        [&]{ doNotOptimize(lhs); doNotOptimize(varRhs); doNotOptimize(visitMixed(op,lhs,varRhs)); },
+        [&]{ doNotOptimize(lhs); doNotOptimize(rhs); doNotOptimize(op(lhs,rhs)); }
+    );
+}
+
+template<typename Operation, typename LhsType, typename RhsType>
+void compareAssign(std::string_view name, Operation op, LhsType lhs, RhsType rhs){
+    GenType genLhs = std::as_const(lhs);
+    GenType genRhs = std::as_const(rhs);
+    Variant varLhs = lhs;
+    Variant varRhs = rhs;
+    compare(name,
+        [&]{ doNotOptimize(genRhs); op(genLhs,genRhs); doNotOptimize(genLhs); },
+        [&]{ doNotOptimize(varRhs); visitAssign(op,varLhs,varRhs); doNotOptimize(varLhs); },
+        [&]{ doNotOptimize(rhs); op(lhs,rhs); doNotOptimize(lhs); }
+    );
+}
+
+int main(int argc, char** argv){
+    parseArguments(argc,argv);
+
+    double local_d = 2.718281828459045;
+    const std::vector<double> vec(1000, 1.5);
+
+    printHeader("Unary operators");
+    compareUnary("operator!(bool)",        [](auto & a) -> decltype(!a) { return !a; }, true);
+    compareUnary("operator!(double)",      [](auto & a) -> decltype(!a) { return !a; }, 3.14);
+    compareUnary("operator*(double*)",     [](auto & a) -> decltype(*a) { return *a; }, &local_d);
+    compareUnary("operator++()(int)",      [](auto & a) -> decltype(++a) { return ++a; }, 1);
+    compareUnary("operator++(int)(int)",   [](auto & a) -> decltype(a++) { return a++; }, 1);
+    compareUnary("operator--()(int)",      [](auto & a) -> decltype(--a) { return --a; }, 1);
+    compareUnary("operator--(int)(int)",   [](auto & a) -> decltype(a--) { return a--; }, 1);
+    compareUnary("operator[](vector<double>)", [](auto & a) -> decltype(a[std::size_t(7)]) { return a[std::size_t(7)]; }, vec);
+
+    printHeader("Binary operators GenType x GenType");
+    compareBinary("operator+(double,double)",  std::plus<>{},          1.5, 2.5);
+    compareBinary("operator+(int,double)",     std::plus<>{},          1,   2.5);
+    compareBinary("operator-(double,double)",  std::minus<>{},         1.5, 2.5);
+    compareBinary("operator*(double,double)",  std::multiplies<>{},    1.5, 2.5);
+    compareBinary("operator*(complex<double>,complex<double>)",
+                                               std::multiplies<>{},    std::complex<double>(1,2), std::complex<double>(3,4));
+    compareBinary("operator/(double,double)",  std::divides<>{},       1.5, 2.5);
+    compareBinary("operator%(int,int)",        std::modulus<>{},       7,   3);
+    compareBinary("operator&(bool,bool)",      std::bit_and<>{},       true, false);
+    compareBinary("operator&&(bool,bool)",     std::logical_and<>{},   true, false);
+    compareBinary("operator^(bool,bool)",      std::bit_xor<>{},       true, false);
+    compareBinary("operator|(bool,bool)",      std::bit_or<>{},        true, false);
+    compareBinary("operator||(bool,bool)",     std::logical_or<>{},    true, false);
+    compareBinary("operator<(double,double)",  std::less<>{},          1.5, 2.5);
+    compareBinary("operator>(double,double)",  std::greater<>{},       1.5, 2.5);
+    compareBinary("operator<=(double,double)", std::less_equal<>{},    1.5, 2.5);
+    compareBinary("operator>=(double,double)", std::greater_equal<>{}, 1.5, 2.5);
+    compareBinary("operator==(double,double)", std::equal_to<>{},      1.5, 2.5);
+    compareBinary("operator!=(double,double)", std::not_equal_to<>{},  1.5, 2.5);
+    compareBinary("operator==(vector<double>,vector<double>)",
+                                               std::equal_to<>{},      vec, vec);
+    compareBinary("operator<(vector<double>,vector<double>)",
+                                               std::less<>{},          vec, vec);
+
+    printHeader("Binary operators Type x GenType");
+    compareMixed("operator+(double,GenType)",  std::plus<>{},          1.5, 2.5);
+    compareMixed("operator-(double,GenType)",  std::minus<>{},         1.5, 2.5);
+    compareMixed("operator*(double,GenType)",  std::multiplies<>{},    1.5, 2.5);
+    compareMixed("operator/(double,GenType)",  std::divides<>{},       1.5, 2.5);
+    compareMixed("operator%(int,GenType)",     std::modulus<>{},       7,   3);
+    compareMixed("operator&(bool,GenType)",    std::bit_and<>{},       true, false);
+    compareMixed("operator&&(bool,GenType)",   std::logical_and<>{},   true, false);
+    compareMixed("operator^(bool,GenType)",    std::bit_xor<>{},       true, false);
+    compareMixed("operator|(bool,GenType)",    std::bit_or<>{},        true, false);
+    compareMixed("operator||(bool,GenType)",   std::logical_or<>{},    true, false);
+    compareMixed("operator<(double,GenType)",  std::less<>{},          1.5, 2.5);
+    compareMixed("operator>(double,GenType)",  std::greater<>{},       1.5, 2.5);
+    compareMixed("operator<=(double,GenType)", std::less_equal<>{},    1.5, 2.5);
+    compareMixed("operator>=(double,GenType)", std::greater_equal<>{}, 1.5, 2.5);
+    compareMixed("operator==(double,GenType)", std::equal_to<>{},      1.5, 2.5);
+    compareMixed("operator!=(double,GenType)", std::not_equal_to<>{},  1.5, 2.5);
+
+    printHeader("Compound assignment operators");
+    compareAssign("operator+=(double,double)", [](auto & a, auto & b) -> decltype(a += b) { return a += b; }, 1.5, 1e-9);
+    compareAssign("operator-=(double,double)", [](auto & a, auto & b) -> decltype(a -= b) { return a -= b; }, 1.5, 1e-9);
+    compareAssign("operator*=(double,double)", [](auto & a, auto & b) -> decltype(a *= b) { return a *= b; }, 1.5, 1.0);
+    compareAssign("operator/=(double,double)", [](auto & a, auto & b) -> decltype(a /= b) { return a /= b; }, 1.5, 1.0);
+    compareAssign("operator%=(int,int)",       [](auto & a, auto & b) -> decltype(a %= b) { return a %= b; }, 7,   1000);
+    compareAssign("operator&=(bool,bool)",     [](auto & a, auto & b) -> decltype(a &= b) { return a &= b; }, true, true);
+    compareAssign("operator|=(bool,bool)",     [](auto & a, auto & b) -> decltype(a |= b) { return a |= b; }, true, true);
+    compareAssign("operator^=(bool,bool)",     [](auto & a, auto & b) -> decltype(a ^= b) { return a ^= b; }, true, false);
+    compareAssign("operator>>=(int,int)",      [](auto & a, auto & b) -> decltype(a >>= b) { return a >>= b; }, 7, 0);
+    compareAssign("operator<<=(int,int)",      [](auto & a, auto & b) -> decltype(a <<= b) { return a <<= b; }, 7, 0);
+
+    printHeader("Reading a held double", {"operator double", "accessor", "raw"});
+    {
+        GenType genT = 3.14;
+        double raw = 3.14;
+        compare("get_if<double>()",
+            [&]{ doNotOptimize(genT); double d = genT; doNotOptimize(d); },
+            [&]{ doNotOptimize(genT); double d = *genT.get_if<double>(); doNotOptimize(d); },
+            [&]{ doNotOptimize(raw); double d = raw; doNotOptimize(d); }
+        );
+        compare("get<double>()",
+            [&]{ doNotOptimize(genT); double d = genT; doNotOptimize(d); },
+            [&]{ doNotOptimize(genT); double d = genT.get<double>(); doNotOptimize(d); },
+            [&]{ doNotOptimize(raw); double d = raw; doNotOptimize(d); }
+        );
+        compare("get_unchecked<double>()",
+            [&]{ doNotOptimize(genT); double d = genT; doNotOptimize(d); },
+            [&]{ doNotOptimize(genT); double d = genT.get_unchecked<double>(); doNotOptimize(d); },
+            [&]{ doNotOptimize(raw); double d = raw; doNotOptimize(d); }
+        );
+        compare("visit",
+            [&]{ doNotOptimize(genT); double d = genT; doNotOptimize(d); },
+            [&]{ doNotOptimize(genT); double d = genT.visit([](const auto & arg) -> double {
+                    if constexpr( std::is_convertible_v<decltype(arg),double> ){ return arg; } else { return 0.0; }
+                 }); doNotOptimize(d); },
+            [&]{ doNotOptimize(raw); double d = raw; doNotOptimize(d); }
+        );
+    }
+
+    printHeader("Conversion and streaming");
+    {
+        GenType genT = 3.14;
+        Variant var = 3.14;
+        double raw = 3.14;
+        compare("operator double()(double)",
+            [&]{ doNotOptimize(genT); double d = genT; doNotOptimize(d); },
+            [&]{ doNotOptimize(var); double d = std::visit(
+                    [](const auto & arg) -> double {
+                        if constexpr( std::is_convertible_v<decltype(arg),double> ){
+                            return static_cast<double>(arg);
+                        } else {
+                            throw std::runtime_error("Unsupported conversion");
+                        }
+                    }, var
+                 ); doNotOptimize(d); },
+            [&]{ doNotOptimize(raw); double d = raw; doNotOptimize(d); }
+        );
+
+        genT = 42;
+        var = 42;
+        int rawInt = 42;
+        compare("operator double()(int)",
+            [&]{ doNotOptimize(genT); double d = genT; doNotOptimize(d); },
+            [&]{ doNotOptimize(var); double d = std::visit(
+                    [](const auto & arg) -> double {
+                        if constexpr( std::is_convertible_v<decltype(arg),double> ){
+                            return static_cast<double>(arg);
+                        } else {
+                            throw std::runtime_error("Unsupported conversion");
+                        }
+                    }, var
+                 ); doNotOptimize(d); },
+            [&]{ doNotOptimize(rawInt); double d = rawInt; doNotOptimize(d); }
+        );
+
+        NullBuffer buffer;
+        std::ostream os(&buffer);
+        genT = 3.14;
+        var = 3.14;
+        compare("operator<<(double)",
+            [&]{ doNotOptimize(genT); os << genT; },
+            [&]{ doNotOptimize(var); std::visit(
+                    [&os](const auto & arg){
+                        if constexpr( hasStreamingOperator<decltype(arg)> ){
+                            os << arg;
+                        } else {
+                            throw std::runtime_error("Unsupported streaming");
+                        }
+                    }, var
+                 ); },
+            [&]{ doNotOptimize(raw); os << raw; }
+        );
+    }
+}
@@ -0,0 +1,69 @@
+#include "../Snapshot.hpp"
+#include "benchmark.hpp"
+#include <string>
+#include <vector>
+
+// Compares reading values from a snapshot in place with decoding the whole binary document first
+// and looking the values up in a GeneralDict.
+
+typedef GeneralType<
+    bool, int, double, std::string, std::vector<double>
+> GenType;
+
+typedef GeneralDict<
+    bool, int, double, std::string, std::vector<double>
+> Dict;
+
+int main(int argc, char** argv){
+    parseArguments(argc,argv);
+
+    // a parameter set of scalars and short strings and a few large vectors
+    Dict parameters;
+    std::vector<std::string> keys;
+    for(std::size_t i = 0; i < 100000; ++i){
+        keys.push_back("parameter" + std::to_string(i));
+        switch( i % 4 ){
+            case 0: parameters[keys.back()] = int(i); break;
+            case 1: parameters[keys.back()] = double(i) * 0.5; break;
+            case 2: parameters[keys.back()] = (i % 3 == 0); break;
+            default: parameters[keys.back()] = std::string("value") + std::to_string(i); break;
+        }
+    }
+    for(std::size_t i = 0; i < 8; ++i){
+        parameters["field" + std::to_string(i)] = std::vector<double>(1 << 17, double(i));
+    }
+
+    const std::vector<std::byte> binary = toBinary(parameters);
+    const std::vector<std::byte> snapshotData = toSnapshot(parameters);
+
+    printHeader("Open and read", {"snapshot", "fromBinary"});
+    compare("one scalar",
+        [&]{
+            const GeneralSnapshot<GenType> snapshot{std::span<const std::byte>(snapshotData)};
+            doNotOptimize(snapshot.at("parameter4").get<int>());
+        },
+        [&]{ doNotOptimize(int(fromBinary<Dict>(binary).at("parameter4"))); }
+    );
+    compare("sum of one vector",
+        [&]{
+            const GeneralSnapshot<GenType> snapshot{std::span<const std::byte>(snapshotData)};
+            double sum = 0;
+            for(double element: snapshot.at("field3").get<std::vector<double>>()){ sum += element; }
+            doNotOptimize(sum);
+        },
+        [&]{
+            double sum = 0;
+            for(double element: std::vector<double>(GenType(fromBinary<Dict>(binary).at("field3")))){ sum += element; }
+            doNotOptimize(sum);
+        }
+    );
+
+    // lookups once the data is open
+    const GeneralSnapshot<GenType> snapshot{std::span<const std::byte>(snapshotData)};
+    std::size_t next = 0;
+    printHeader("Lookup", {"snapshot", "GeneralDict"});
+    compare("int by key",
+        [&]{ doNotOptimize(snapshot.at(keys[next = (next + 4) % keys.size()]).get<int>()); },
+        [&]{ doNotOptimize(int(parameters.at(keys[next = (next + 4) % keys.size()]))); }
+    );
+}
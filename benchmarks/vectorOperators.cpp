@@ -0,0 +1,85 @@
+#include "../GeneralType.hpp"
+#include "benchmark.hpp"
+#include <complex>
+#include <vector>
+#include <functional>
+
+// Compares the element wise operators of GenTypes holding std::vectors with a plain loop over
+// std::vectors creating a new result vector, i.e. doing the same work without the GenType.
+// The element wise operators of the GenType run on the widest instruction set the CPU supports.
+
+// The same type list as in Examples/basicUsage.cpp
+typedef GeneralType<
+    bool,int,
+    float,double,
+    std::complex<float>,std::complex<double>,
+    std::vector<bool>, std::vector<int>,std::vector<float>,std::vector<double>,
+    std::vector<std::complex<float>>,std::vector<std::complex<double>>,
+    double*
+> GenType;
+
+//! Number of elements per vector
+constexpr std::size_t size = 4096;
+
+//! Apply `op` element wise to two vectors in a plain loop
+template<typename Result, typename Lhs, typename Rhs, typename Operation>
+std::vector<Result> rawLoop(const std::vector<Lhs> & lhs, const std::vector<Rhs> & rhs, Operation op){
+    std::vector<Result> result(lhs.size());
+    for(std::size_t i = 0; i < lhs.size(); ++i){ result[i] = op(lhs[i],rhs[i]); }
+    return result;
+}
+
+//! Apply `op` to every element of a vector and a scalar in a plain loop
+template<typename Result, typename Lhs, typename Rhs, typename Operation>
+std::vector<Result> rawLoop(const std::vector<Lhs> & lhs, const Rhs & rhs, Operation op){
+    std::vector<Result> result(lhs.size());
+    for(std::size_t i = 0; i < lhs.size(); ++i){ result[i] = op(lhs[i],rhs); }
+    return result;
+}
+
+template<typename Result, typename Lhs, typename Rhs, typename Operation>
+void compareVectors(std::string_view name, const Lhs & lhs, const Rhs & rhs, Operation op){
+    const GenType genLhs = lhs;
+    const GenType genRhs = rhs;
+    compare(name,
+        [&]{ doNotOptimize(op(genLhs,genRhs)); },
+        [&]{ doNotOptimize(rawLoop<Result>(lhs,rhs,op)); }
+    );
+}
+
+int main(int argc, char** argv){
+    parseArguments(argc,argv);
+
+    std::vector<double> doubles(size), otherDoubles(size);
+    std::vector<float> floats(size);
+    std::vector<int> ints(size);
+    std::vector<std::complex<double>> complexes(size);
+    for(std::size_t i = 0; i < size; ++i){
+        doubles[i] = double(i) * 0.5;
+        otherDoubles[i] = double(size - i);
+        floats[i] = float(i) * 0.25f;
+        ints[i] = int(i % 7);
+        complexes[i] = {double(i), 1.0};
+    }
+
+    printHeader("Element wise operators on vectors of 4096 elements", {"GenType", "raw loop"});
+    compareVectors<double>("vector<double> + vector<double>", doubles, otherDoubles, std::plus<>{});
+    compareVectors<double>("vector<double> * vector<double>", doubles, otherDoubles, std::multiplies<>{});
+    compareVectors<double>("vector<double> / double",         doubles, 3.0,          std::divides<>{});
+    compareVectors<float>("vector<float> - vector<float>",    floats,  floats,       std::minus<>{});
+    compareVectors<double>("vector<double> + vector<int>",    doubles, ints,         std::plus<>{});
+    compareVectors<int>("vector<int> * vector<int>",          ints,    ints,         std::multiplies<>{});
+    compareVectors<bool>("vector<double> < vector<double>",   doubles, otherDoubles, std::less<>{});
+    compareVectors<std::complex<double>>("vector<complex<double>> * double", complexes, 2.0, std::multiplies<>{});
+
+    GenType accumulator = std::as_const(doubles);
+    const GenType increment = std::as_const(otherDoubles);
+    std::vector<double> rawAccumulator = doubles;
+    compare("vector<double> += vector<double>",
+        [&]{ accumulator += increment; doNotOptimize(accumulator); },
+        [&]{
+            for(std::size_t i = 0; i < size; ++i){ rawAccumulator[i] += otherDoubles[i]; }
+            doNotOptimize(rawAccumulator);
+        }
+    );
+}
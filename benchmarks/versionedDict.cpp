@@ -0,0 +1,140 @@
+#include "../VersionedGeneralDict.hpp"
+#include "../ConcurrentGeneralDict.hpp"
+#include "benchmark.hpp"
+#include <atomic>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Measures reading a parameter of a configuration that is replaced as a whole from time to time. A
+// VersionedGeneralDict is compared with a ConcurrentGeneralDict, a GeneralDict behind a global
+// std::shared_mutex and a std::atomic<std::shared_ptr> to the current dictionary, whose readers share
+// a reference count. Every thread reads `reads` parameters while one more thread publishes `reloads` new
+// configurations, a row reports the time until all threads are done.
+
+typedef GeneralType<
+    bool, int, double, std::string
+> GenType;
+
+typedef VersionedGeneralDict<
+    bool, int, double, std::string
+> Config;
+
+typedef ConcurrentGeneralDict<
+    bool, int, double, std::string
+> SharedDict;
+
+typedef Config::Dict Dict;
+
+//! Number of parameters of the configuration
+constexpr std::size_t numberOfKeys = 100;
+
+//! Number of reads per thread and benchmark iteration
+constexpr std::size_t reads = 100000;
+
+//! Number of configurations published per benchmark iteration
+constexpr std::size_t reloads = 10;
+
+//! Run `reader(thread)` on `numberOfThreads` threads and `writer()` on one more thread
+template<typename Reader, typename Writer>
+void runThreads(std::size_t numberOfThreads, Reader && reader, Writer && writer){
+    std::vector<std::thread> threads;
+    threads.reserve(numberOfThreads + 1);
+    for(std::size_t t = 0; t < numberOfThreads; ++t){
+        threads.emplace_back(reader, t);
+    }
+    threads.emplace_back(writer);
+    for(std::thread & thread: threads){ thread.join(); }
+}
+
+int main(int argc, char** argv){
+    parseArguments(argc,argv);
+
+    std::vector<std::string> keys;
+    Dict dict;
+    for(std::size_t i = 0; i < numberOfKeys; ++i){
+        keys.push_back("parameter" + std::to_string(i));
+        dict[keys.back()] = double(i);
+    }
+
+    Config config(dict);
+    SharedDict sharedDict;
+    for(const auto & [key,value]: dict){ sharedDict.insert_or_assign(key, value); }
+    Dict lockedDict = dict;
+    std::shared_mutex mutex;
+    std::atomic<std::shared_ptr<const Dict>> pointer = std::make_shared<const Dict>(dict);
+
+    //! Sum `reads` parameters, starting at a different one in every thread
+    auto readAll = [](std::size_t thread, auto && read){
+        double sum = 0;
+        for(std::size_t i = 0; i < reads; ++i){
+            sum += read((thread * 31 + i) % numberOfKeys);
+        }
+        doNotOptimize(sum);
+    };
+    auto versionedReader = [&](std::size_t thread){
+        readAll(thread, [&](std::size_t k){ return *config.read()->find(keys[k])->second.get_if<double>(); });
+    };
+    auto concurrentReader = [&](std::size_t thread){
+        readAll(thread, [&](std::size_t k){
+            double value = 0;
+            sharedDict.visit(keys[k], [&value](const GenType & held){ value = *held.get_if<double>(); });
+            return value;
+        });
+    };
+    auto mutexReader = [&](std::size_t thread){
+        readAll(thread, [&](std::size_t k){
+            std::shared_lock lock(mutex);
+            return *lockedDict.find(keys[k])->second.get_if<double>();
+        });
+    };
+    auto pointerReader = [&](std::size_t thread){
+        readAll(thread, [&](std::size_t k){ return *pointer.load()->find(keys[k])->second.get_if<double>(); });
+    };
+
+    // the writers publish a copy of the configuration with one changed parameter
+    auto versionedWriter = [&]{
+        for(std::size_t i = 0; i < reloads; ++i){
+            config.update([&](Dict & next){ next[keys[i]] = double(i); });
+            std::this_thread::yield();
+        }
+    };
+    auto concurrentWriter = [&]{
+        for(std::size_t i = 0; i < reloads; ++i){
+            sharedDict.insert_or_assign(keys[i], double(i));
+            std::this_thread::yield();
+        }
+    };
+    auto mutexWriter = [&]{
+        for(std::size_t i = 0; i < reloads; ++i){
+            Dict next = lockedDict;
+            next[keys[i]] = double(i);
+            std::unique_lock lock(mutex);
+            lockedDict = std::move(next);
+            lock.unlock();
+            std::this_thread::yield();
+        }
+    };
+    auto pointerWriter = [&]{
+        for(std::size_t i = 0; i < reloads; ++i){
+            auto next = std::make_shared<Dict>(*pointer.load());
+            (*next)[keys[i]] = double(i);
+            pointer.store(std::move(next));
+            std::this_thread::yield();
+        }
+    };
+
+    std::cout << "Hardware threads: " << std::thread::hardware_concurrency() << std::endl;
+    printHeader("Reading threads, " + std::to_string(reads) + " reads each, " + std::to_string(reloads) + " reloads",
+        {"versioned", "concurrent", "shared_mutex", "shared_ptr"});
+    for(std::size_t numberOfThreads: {1, 2, 4, 8}){
+        compare(std::to_string(numberOfThreads) + " threads",
+            [&]{ runThreads(numberOfThreads, versionedReader, versionedWriter); },
+            [&]{ runThreads(numberOfThreads, concurrentReader, concurrentWriter); },
+            [&]{ runThreads(numberOfThreads, mutexReader, mutexWriter); },
+            [&]{ runThreads(numberOfThreads, pointerReader, pointerWriter); }
+        );
+    }
+}